@@ -71,17 +71,22 @@ class configuration:
   # Build the openmoc.cuda module
   with_cuda = False
 
+  # The SIMD instruction set targeted by the GCC and Clang compilers
+  # ('auto' for the compiler's default, 'native', 'avx2' or 'avx512')
+  simd = 'auto'
+
   # The vector length used for the VectorizedSolver class. This will used
-  # as a hint for the Intel compiler to issue SIMD (ie, SSE, AVX, etc) vector
-  # instructions. This is accomplished by adding "dummy" energy groups such
-  # that the number of energy groups is be fit too a multiple of this
-  # vector_length, and restructuring the innermost loops in the solver to
-  # loop from 0 to the vector length
+  # as a hint for the compiler to issue SIMD (ie, SSE, AVX, etc) vector
+  # instructions within OpenMP SIMD loops. This is accomplished by adding
+  # "dummy" energy groups such that the number of energy groups is be fit
+  # too a multiple of this vector_length, and restructuring the innermost
+  # loops in the solver to loop from 0 to the vector length
   vector_length = 8
 
   # The vector alignment used in the VectorizedSolver class when allocating
-  # aligned data structures using MM_MALLOC and MM_FREE
-  vector_alignment = 16
+  # aligned data structures using MM_MALLOC and MM_FREE. This is the width
+  # of a cache line and of an AVX-512 register (64 bytes)
+  vector_alignment = 64
 
   # List of C/C++/CUDA distutils.extension objects which are created based
   # on which flags are specified at compile time.
@@ -111,6 +116,8 @@ class configuration:
                     'src/ExpEvaluator.cpp',
                     'src/Solver.cpp',
                     'src/CPUSolver.cpp',
+                    'src/KrylovSolver.cpp',
+                    'src/VectorizedSolver.cpp',
                     'src/Surface.cpp',
                     'src/Timer.cpp',
                     'src/Track.cpp',
@@ -136,6 +143,8 @@ class configuration:
                       'src/ExpEvaluator.cpp',
                       'src/Solver.cpp',
                       'src/CPUSolver.cpp',
+                      'src/KrylovSolver.cpp',
+                      'src/VectorizedSolver.cpp',
                       'src/Surface.cpp',
                       'src/Timer.cpp',
                       'src/Track.cpp',
@@ -162,6 +171,7 @@ class configuration:
                      'src/ExpEvaluator.cpp',
                      'src/Solver.cpp',
                      'src/CPUSolver.cpp',
+                     'src/KrylovSolver.cpp',
                      'src/VectorizedSolver.cpp',
                      'src/Surface.cpp',
                      'src/Timer.cpp',
@@ -189,6 +199,7 @@ class configuration:
                       'src/ExpEvaluator.cpp',
                       'src/Solver.cpp',
                       'src/CPUSolver.cpp',
+                      'src/KrylovSolver.cpp',
                       'src/Surface.cpp',
                       'src/Timer.cpp',
                       'src/Track.cpp',
@@ -235,6 +246,15 @@ class configuration:
                              '--compiler-options', '-fpic',
                              '-arch=compute_20']
 
+  # A dictionary of the GCC and Clang compiler flags for each SIMD
+  # instruction set used by the VectorizedSolver
+  simd_flags = dict()
+
+  simd_flags['auto'] = []
+  simd_flags['native'] = ['-march=native']
+  simd_flags['avx2'] = ['-mavx2', '-mfma']
+  simd_flags['avx512'] = ['-mavx512f', '-mavx512cd', '-mfma']
+
 
   #############################################################################
   #                                 Linker Flags
@@ -277,7 +297,7 @@ class configuration:
   shared_libraries['gcc'] = ['stdc++', 'gomp', 'dl','pthread', 'm']
   shared_libraries['clang'] = ['stdc++', 'gomp', 'dl','pthread', 'm']
   shared_libraries['icpc'] = ['stdc++', 'iomp5', 'pthread', 'irc',
-                              'imf','rt', 'mkl_rt','m',]
+                              'imf','rt', 'm']
   shared_libraries['bgxlc'] = ['stdc++', 'pthread', 'm', 'xlsmp', 'rt']
   shared_libraries['nvcc'] = ['cudadevrt', 'cudart']
 
@@ -355,7 +375,6 @@ class configuration:
   macros['icpc']['single']= [('FP_PRECISION', 'float'),
                              ('SINGLE', None),
                              ('ICPC', None),
-                             ('MKL_ILP64', None),
                              ('VEC_LENGTH', vector_length),
                              ('VEC_ALIGNMENT', vector_alignment)]
 
@@ -386,8 +405,7 @@ class configuration:
   macros['icpc']['double'] = [('FP_PRECISION', 'double'),
                               ('DOUBLE', None),
                               ('ICPC', None),
-                              ('MKL_ILP64', None),
-                              ('VEC_LENGTH', vector_length),
+                               ('VEC_LENGTH', vector_length),
                               ('VEC_ALIGNMENT', vector_alignment)]
 
   macros['bgxlc']['double'] = [('FP_PRECISION', 'double'),
@@ -429,6 +447,11 @@ class configuration:
         self.compiler_flags[k].append('-pg')
         self.compiler_flags[k].append('-g')
 
+    # Append the flags for the SIMD instruction set to the GCC and Clang
+    # compiler flags
+    for k in ['gcc', 'clang']:
+      self.compiler_flags[k] += self.simd_flags[self.simd]
+
     # Obtain the NumPy include directory
     try:
       numpy_include = numpy.get_include()
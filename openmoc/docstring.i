@@ -736,6 +736,22 @@ Returns
 the Material fill pointer  
 ";
 
+%feature("docstring") Cell::containsCoordsStrictly "
+containsCoordsStrictly(LocalCoords *coords) -> bool  
+
+Determines whether a LocalCoords is inside a Cell and not on any of the Cell's Surfaces.  
+
+A LocalCoords which is strictly inside a Cell is not contained by any other Cell which
+does not overlap it. A Cell without a bounding Region strictly contains everything if it
+is filled by a Material and is conservatively taken to contain nothing strictly if it is
+filled by a Universe.  
+
+Parameters
+----------
+* coords :  
+    a pointer to a localcoord  
+";
+
 %feature("docstring") Cell::containsCoords "
 containsCoords(LocalCoords *coords) -> bool  
 
@@ -891,6 +907,20 @@ Parameters
 zeroCurrents()  
 
 Zero the surface currents for each mesh cell and energy group.  
+
+Each thread tallies surface currents into its own copy of the currents during a transport
+sweep, which are allocated here for the maximum number of OpenMP threads if needed. This
+requires memory for the currents of every CMFD cell surface and group for each thread. The
+copies are summed into the surface currents by reduceCurrents() after the transport sweep.  
+";
+
+%feature("docstring") Cmfd::reduceCurrents "
+reduceCurrents()  
+
+Sums the surface currents tallied by each thread into the surface currents for each mesh
+cell and energy group.  
+
+This method is called once after each transport sweep.  
 ";
 
 %feature("docstring") Cmfd::setGroupStructure "
@@ -1008,6 +1038,9 @@ tallyCurrent(segment *curr_segment, FP_PRECISION *track_flux, int azim_index, bo
 Tallies the current contribution from this segment across the the appropriate CMFD mesh
 cell surface.  
 
+The current is tallied into the calling thread's copy of the surface currents without
+locking.  
+
 Parameters
 ----------
 * curr_segment :  
@@ -1178,13 +1211,17 @@ The CMFD cell ID.
 ";
 
 %feature("docstring") Cmfd::updateBoundaryFlux "
-updateBoundaryFlux(Track **tracks, FP_PRECISION *boundary_flux, int num_tracks)  
+updateBoundaryFlux(Track **tracks, FP_PRECISION *boundary_flux, long
+    *boundary_flux_offsets, int num_tracks)  
 
 Update the MOC boundary fluxes.  
 
 The MOC boundary fluxes are updated using the P0 approximation. With this approximation,
 the boundary fluxes are updated using the ratio of new to old flux for the cell that the
-outgoing flux from the track enters.  
+outgoing flux from the track enters. The CMFD cell at each Track end is found on the first
+update after the Tracks or the CMFD mesh change, and the flux ratios are expanded to the
+MOC energy groups so that each Track end is rescaled with a contiguous loop over polar
+angles and groups.  
 
 Parameters
 ----------
@@ -1192,10 +1229,11 @@ Parameters
     2D array of Tracks  
 * boundary_flux :  
     Array of boundary fluxes  
-
-Returns
--------
-The number of Tracks  
+* boundary_flux_offsets :  
+    The offset of each Track's forward and reverse boundary fluxes in the boundary flux
+    array  
+* num_tracks :  
+    The number of Tracks  
 ";
 
 %feature("docstring") Cmfd::setBoundary "
@@ -2126,6 +2164,131 @@ fsr_data()
 Constructor for FSR data initializes centroids and points to NULL  
 ";
 
+// File: classFrozenHashMap.xml
+
+
+%feature("docstring") FrozenHashMap "
+
+A read-only hash map built once from a list of key/value pairs.  
+
+The FrozenHashMap class stores its key/value pairs in a single open addressing table with
+linear probing which is at most half full. Once built it is never modified, so lookups
+from any number of threads take no locks, make no announcements and allocate no memory.
+It is intended to index data which is fixed after initialization.  
+
+C++ includes: src/ParallelHashMap.h
+";
+
+%feature("docstring") FrozenHashMap::FrozenHashMap "
+FrozenHashMap()  
+
+Constructor initializes an empty frozen table.  
+";
+
+%feature("docstring") FrozenHashMap::~FrozenHashMap "
+~FrozenHashMap()  
+
+Destructor deletes the table of slots.  
+";
+
+%feature("docstring") FrozenHashMap::build "
+build(K *keys, V *values, size_t N)  
+
+Builds the table from arrays of keys and values.  
+
+Any previous contents of the table are discarded. The table size is the smallest power of
+2 at least twice the number of pairs so that probe sequences remain short. If a key
+appears more than once, the first value is kept. This method is not thread safe and must
+not be called while other threads are reading from the table.  
+
+Parameters
+----------
+* keys :  
+    an array of keys  
+* values :  
+    an array of the values associated with each key  
+* N :  
+    the number of key/value pairs  
+";
+
+%feature("docstring") FrozenHashMap::find "
+find(K key, V &value) const  -> bool  
+
+Determine the value associated with a given key if it is present.  
+
+The slots following the slot associated with the key are searched until the key or an
+empty slot is found. No exception is thrown when the key is not present.  
+
+Parameters
+----------
+* key :  
+    key to be searched  
+* value :  
+    set to the value associated with the key if it is present  
+
+Returns
+-------
+boolean value referring to whether the key is contained in the map  
+";
+
+%feature("docstring") FrozenHashMap::contains "
+contains(K key) const  -> bool  
+
+Determine whether the frozen table contains a given key.  
+
+Parameters
+----------
+* key :  
+    key to be searched  
+
+Returns
+-------
+boolean value referring to whether the key is contained in the map  
+";
+
+%feature("docstring") FrozenHashMap::at "
+at(K key) const  -> V  
+
+Determine the value associated with a given key in the frozen table.  
+
+An exception is thrown if the key is not present in the map.  
+
+Parameters
+----------
+* key :  
+    key whose corresponding value is desired  
+
+Returns
+-------
+value associated with the given key  
+";
+
+%feature("docstring") FrozenHashMap::size "
+size() const  -> size_t  
+
+Returns the number of key/value pairs in the frozen table.  
+
+Returns
+-------
+number of key/value pairs in the map  
+";
+
+%feature("docstring") FrozenHashMap::bucket_count "
+bucket_count() const  -> size_t  
+
+Returns the number of slots in the frozen table.  
+
+Returns
+-------
+number of slots in the map  
+";
+
+%feature("docstring") FrozenHashMap::clear "
+clear()  
+
+Clears all key/value pairs from the frozen table.  
+";
+
 // File: classGeometry.xml
 
 
@@ -2161,6 +2324,18 @@ Geometry::segmentize() has completed. It should not be called if tracks are load
 file.  
 ";
 
+%feature("docstring") Geometry::initializeFSRIndex "
+initializeFSRIndex()  
+
+Builds the read-only index of FSR IDs by FSR key.  
+
+This is called once the FSRs have all been identified, either by initializeFSRVectors()
+after ray tracing or by the TrackGenerator after reading Tracks from a file. Lookups of
+these FSRs by findFSRId() and getFSRId() then search a flat open addressing table without
+taking locks or allocating memory, and the fsr_data for each FSR ID is found without
+hashing.  
+";
+
 %feature("docstring") Geometry::findCellContainingFSR "
 findCellContainingFSR(int fsr_id) -> Cell *  
 
@@ -2213,33 +2388,52 @@ the maximum x-coordinate (cm)
 ";
 
 %feature("docstring") Geometry::initializeFSRs "
-initializeFSRs(bool neighbor_cells=false)  
+initializeFSRs()  
 
 Compute the number of flat source regions in the Geometry and initialize CMFD.  
 
 This method is intended to be called by the user before initiating source iteration. This
 method first subdivides all Cells by calling the Geometry::subdivideCells() method. Then
-it initializes the CMFD object. neighbor_cells whether to use neighbor cell optimizations  
+it builds the index of Cells in each Universe used to speed up the search for the Cell
+containing a point and caches the bounds and nesting depth of the Geometry.  
 ";
 
 %feature("docstring") Geometry::segmentize "
-segmentize(Track *track)  
+segmentize(Track *track, LocalCoords *levels=NULL)  
 
 This method performs ray tracing to create Track segments within each flat source region
 in the Geometry.  
 
 This method starts at the beginning of a Track and finds successive intersection points
 with FSRs as the Track crosses through the Geometry and creates segment structs and adds
-them to the Track.  
+them to the Track. The LocalCoords below the highest level are taken from the levels array
+if one is given so that the heap is not touched.  
 
 Parameters
 ----------
 * track :  
     a pointer to a track to segmentize  
+* levels :  
+    an array of 2 * (getMaxNestingDepth() - 1) LocalCoords for the lower levels of the
+    segments' start and end, or NULL  
+";
+
+%feature("docstring") Geometry::getMaxNestingDepth "
+getMaxNestingDepth() -> int  
+
+Returns the maximum number of levels of nested Universes and Lattices in the Geometry.  
+
+This is the maximum length of a LocalCoords linked list built by
+findCellContainingCoords(). It is computed once the Cells have been subdivided by
+initializeFSRs().  
+
+Returns
+-------
+the maximum nesting depth of the Geometry  
 ";
 
 %feature("docstring") Geometry::getFSRsToKeys "
-getFSRsToKeys() -> std::vector< std::string > &  
+getFSRsToKeys() -> std::vector< fsr_key > &  
 
 Returns the vector that maps FSR IDs to FSR key hashes.  
 
@@ -2264,6 +2458,9 @@ getFSRId(LocalCoords *coords) -> int
 
 Return the ID of the flat source region that a given LocalCoords object resides within.  
 
+Once the FSRs have been indexed by initializeFSRIndex() the lookup takes no locks and
+allocates no memory, so this may be called from many threads at once.  
+
 Parameters
 ----------
 * coords :  
@@ -2290,7 +2487,7 @@ the FSR's centroid
 ";
 
 %feature("docstring") Geometry::getFSRKeysMap "
-getFSRKeysMap() -> ParallelHashMap< std::string, fsr_data * > &  
+getFSRKeysMap() -> ParallelHashMap< fsr_key, fsr_data * > &  
 
 Returns a pointer to the map that maps FSR keys to FSR IDs.  
 
@@ -2361,15 +2558,16 @@ the number of Cells
 ";
 
 %feature("docstring") Geometry::getFSRKey "
-getFSRKey(LocalCoords *coords) -> std::string  
+getFSRKey(LocalCoords *coords) -> fsr_key  
 
-Generate a string FSR \"key\" that identifies an FSR by its unique hierarchical
+Generate an FSR key that identifies an FSR by its unique hierarchical
 lattice/universe/cell structure.  
 
 Since not all FSRs will reside on the absolute lowest universe level and Cells might
 overlap other cells, it is important to have a method for uniquely identifying FSRs. This
-method creates a unique FSR key by constructing a structured string that describes the
-hierarchy of lattices/universes/cells.  
+method creates a unique FSR key by hashing the CMFD cell and the lattice IDs and cells,
+universe IDs and cell ID along the hierarchy of lattices/universes/cells. Each level is
+prefixed by its type so that different hierarchies hash different sequences of integers.  
 
 Parameters
 ----------
@@ -2381,6 +2579,26 @@ Returns
 the FSR key  
 ";
 
+%feature("docstring") Geometry::getFSRKeyString "
+getFSRKeyString(LocalCoords *coords) -> std::string  
+
+Generate a human-readable string describing the unique hierarchical
+lattice/universe/cell structure of an FSR.  
+
+The string contains the same hierarchy as the FSR key returned by
+Geometry::getFSRKey(...) and is intended for plotting and debugging rather than for
+identifying FSRs during ray tracing.  
+
+Parameters
+----------
+* coords :  
+    a LocalCoords object pointer  
+
+Returns
+-------
+the FSR key string  
+";
+
 %feature("docstring") Geometry::subdivideCells "
 subdivideCells()  
 
@@ -2403,6 +2621,44 @@ Returns
 the root Universe  
 ";
 
+%feature("docstring") Geometry::findDomainsAtPoints "
+findDomainsAtPoints(double *points, int num_points, int num_dims, int *domains, int
+    num_domains, double zcoord=0.0)  
+
+Finds the FSR, Cell and Material IDs at many points.  
+
+This is the batched form of findCellContainingCoords() and getFSRId() for post-
+processing, such as plotting and mesh tallies, over very many points. The points are
+divided into contiguous blocks among the OpenMP threads. Each thread keeps the LocalCoords
+linked list of the previous point in its block, so that when the points are sorted or lie
+on a grid the Lattice cells and Cells at each level are usually reused rather than
+searched from the root. A Cell is only reused for points which are not on its Surfaces, so
+the IDs do not depend on the order of the points or the number of threads. The IDs for
+each point are returned in consecutive entries of the domains array in the order FSR ID,
+Cell ID and Material ID. Points outside the Geometry have IDs of -1, as do points in FSRs
+which were not crossed by any Track. This method may be called from Python as follows:  
+
+
+     points = numpy.array([[0.1, 0.2], [0.3, 0.4]])
+     domains = geometry.findDomainsAtPoints(points, 3 * len(points))
+     fsr_ids, cell_ids, material_ids = domains.reshape(-1, 3).T  
+
+Parameters
+----------
+* points :  
+    an array of the x and y (and optionally z) coordinates of each point  
+* num_points :  
+    the number of points  
+* num_dims :  
+    the number of coordinates of each point (2 or 3)  
+* domains :  
+    an array of length 3 * num_points for the domain IDs  
+* num_domains :  
+    the length of the domains array  
+* zcoord :  
+    the z-coordinate of the points if only x and y are given  
+";
+
 %feature("docstring") Geometry::getSpatialDataOnGrid "
 getSpatialDataOnGrid(std::vector< double > grid_x, std::vector< double > grid_y, double
     zcoord, const char *domain_type=\"material\") -> std::vector< int >  
@@ -2482,7 +2738,7 @@ Constructor initializes an empty Geometry.
 ";
 
 %feature("docstring") Geometry::findCellContainingCoords "
-findCellContainingCoords(LocalCoords *coords) -> Cell *  
+findCellContainingCoords(LocalCoords *coords, bool moved=false, bool strict=false) -> Cell *  
 
 Find the Cell that this LocalCoords object is in at the lowest level of the nested
 Universe hierarchy.  
@@ -2494,12 +2750,20 @@ as an argument down to the lowest level Cell found. In the process it will set t
 coordinates at each level of the hierarchy for each LocalCoord in the linked list for the
 Lattice or Universe that it is in. If the LocalCoords is outside the bounds of the
 Geometry or on the boundaries this method will return NULL; otherwise it will return a
-pointer to the Cell that is found by the recursive Geometry::findCell(...) method.  
+pointer to the Cell that is found by the recursive Geometry::findCell(...) method.
+LocalCoords already in the linked list are reused rather than reallocated.  
 
 Parameters
 ----------
 * coords :  
     pointer to a LocalCoords object  
+* moved :  
+    whether the LocalCoords linked list was found by a previous search and then moved
+    across at most one Surface, or any distance if the search is strict, in which case the
+    Cells it was previously in are used to speed up the search  
+* strict :  
+    whether the Cells the LocalCoords were previously in are only kept if they are not on
+    their Surfaces, which always finds the same Cell as a search from scratch  
 
 Returns
 -------
@@ -3215,6 +3479,246 @@ A struct used to check if a value on the GPU is equal to NaN.
 This is used as a predicate in Thrust routines.  
 ";
 
+// File: classKrylovSolver.xml
+
+
+%feature("docstring") KrylovSolver "
+
+Matrix-free Krylov subspace methods built on a Solver's transport sweeps.  
+
+The KrylovSolver applies the scattering, fission and transport operators by sweeping
+with the Solver's own flux and source arrays. It inverts them with restarted GMRES, and
+computes the eigenmodes of the k-eigenvalue problem (I - TS)^-1 TF with the implicitly
+restarted Arnoldi method. The operators are only linear with vacuum boundary conditions.  
+
+C++ includes: src/KrylovSolver.h
+";
+
+%feature("docstring") KrylovSolver::KrylovSolver "
+KrylovSolver(Solver *solver)  
+
+Constructor initializes an empty KrylovSolver for a Solver.  
+
+Parameters
+----------
+* solver :  
+    the Solver used to apply the transport operators  
+";
+
+%feature("docstring") KrylovSolver::computeEigenmodes "
+computeEigenmodes(solverMode mode=FORWARD)  
+
+Computes the eigenmodes of the k-eigenvalue problem with the implicitly restarted
+Arnoldi method.  
+
+The eigenmodes with the largest eigenvalues of the operator (I - TS)^-1 TF are
+computed, where each application of the inverse of the scattering operator is a GMRES
+solve. The fundamental eigenvalue and eigenvector are stored in the Solver as its
+eigenvalue and FSR scalar fluxes. This method may be called from Python as follows:  
+
+    krylov_solver = openmoc.KrylovSolver(solver)
+    krylov_solver.setNumModes(5)
+    krylov_solver.computeEigenmodes()  
+
+Parameters
+----------
+* mode :  
+    the solution type (FORWARD or ADJOINT)  
+";
+
+%feature("docstring") KrylovSolver::computeFlux "
+computeFlux(solverMode mode=FORWARD, double k_eff=1.)  
+
+Computes the scalar flux for the fixed sources with GMRES.  
+
+The flux solves (I - T(S + F/k)) phi = T q, where T q is the uncollided flux from the
+fixed sources q. This converges in fewer transport sweeps than the source iterations of
+Solver::computeFlux() for optically thick, highly scattering problems. The flux is
+stored in the Solver.  
+
+Parameters
+----------
+* mode :  
+    the solution type (FORWARD or ADJOINT)  
+* k_eff :  
+    the sub/super-critical eigenvalue (default 1.0)  
+";
+
+%feature("docstring") KrylovSolver::getEigenvalue "
+getEigenvalue(int mode) -> double  
+
+Returns the real part of an eigenvalue.  
+
+The eigenvalues are sorted by decreasing magnitude such that mode 0 is the fundamental
+mode.  
+
+Parameters
+----------
+* mode :  
+    the index of the eigenmode  
+
+Returns
+-------
+the real part of the eigenvalue  
+";
+
+%feature("docstring") KrylovSolver::getEigenvalueImag "
+getEigenvalueImag(int mode) -> double  
+
+Returns the imaginary part of an eigenvalue.  
+
+Parameters
+----------
+* mode :  
+    the index of the eigenmode  
+
+Returns
+-------
+the imaginary part of the eigenvalue  
+";
+
+%feature("docstring") KrylovSolver::getEigenvector "
+getEigenvector(int mode, double *eigenvector, int num_fluxes)  
+
+Copies the real part of an eigenvector into an array.  
+
+The eigenvectors are normalized to a unit 2-norm. This method may be called from Python
+to retrieve an eigenvector as a NumPy array as follows:  
+
+    num_fluxes = geometry.getNumFSRs() * geometry.getNumEnergyGroups()
+    eigenvector = krylov_solver.getEigenvector(mode, num_fluxes)  
+
+Parameters
+----------
+* mode :  
+    the index of the eigenmode  
+* eigenvector :  
+    an array of FSR scalar fluxes in each energy group  
+* num_fluxes :  
+    the total number of FSR flux values  
+";
+
+%feature("docstring") KrylovSolver::getNumConvergedModes "
+getNumConvergedModes() -> int  
+
+Returns the number of eigenmodes which converged in the last call to
+computeEigenmodes().  
+
+Returns
+-------
+the number of converged eigenmodes  
+";
+
+%feature("docstring") KrylovSolver::getNumScatterSweeps "
+getNumScatterSweeps() -> int  
+
+Returns the number of transport sweeps with the scattering source in the last solve.  
+
+Returns
+-------
+the number of scattering source transport sweeps  
+";
+
+%feature("docstring") KrylovSolver::getNumFissionSweeps "
+getNumFissionSweeps() -> int  
+
+Returns the number of transport sweeps with the fission source in the last solve.  
+
+Returns
+-------
+the number of fission source transport sweeps  
+";
+
+%feature("docstring") KrylovSolver::getNumTotalSweeps "
+getNumTotalSweeps() -> int  
+
+Returns the number of transport sweeps with the total source in the last solve.  
+
+Returns
+-------
+the number of total source transport sweeps  
+";
+
+%feature("docstring") KrylovSolver::setNumModes "
+setNumModes(int num_modes)  
+
+Sets the number of eigenmodes to compute.  
+
+Parameters
+----------
+* num_modes :  
+    the number of eigenmodes (> 0)  
+";
+
+%feature("docstring") KrylovSolver::setSubspaceSize "
+setSubspaceSize(int subspace_size)  
+
+Sets the maximum dimension of the Arnoldi subspace.  
+
+The subspace must hold at least two more vectors than the number of eigenmodes. A value
+of 0 uses max(2 x # modes + 1, 20) vectors.  
+
+Parameters
+----------
+* subspace_size :  
+    the dimension of the Arnoldi subspace  
+";
+
+%feature("docstring") KrylovSolver::setGMRESRestart "
+setGMRESRestart(int restart)  
+
+Sets the number of GMRES iterations between restarts.  
+
+Parameters
+----------
+* restart :  
+    the GMRES restart length (> 0)  
+";
+
+%feature("docstring") KrylovSolver::setMaxInnerIterations "
+setMaxInnerIterations(int max_iters)  
+
+Sets the maximum number of GMRES iterations for each linear solve.  
+
+Parameters
+----------
+* max_iters :  
+    the maximum number of GMRES iterations (> 0)  
+";
+
+%feature("docstring") KrylovSolver::setMaxOuterIterations "
+setMaxOuterIterations(int max_iters)  
+
+Sets the maximum number of implicit restarts of the Arnoldi method.  
+
+Parameters
+----------
+* max_iters :  
+    the maximum number of Arnoldi restarts (> 0)  
+";
+
+%feature("docstring") KrylovSolver::setInnerTolerance "
+setInnerTolerance(double tolerance)  
+
+Sets the relative residual tolerance for the GMRES solves.  
+
+Parameters
+----------
+* tolerance :  
+    the inner tolerance (> 0)  
+";
+
+%feature("docstring") KrylovSolver::setOuterTolerance "
+setOuterTolerance(double tolerance)  
+
+Sets the relative residual tolerance for the Ritz eigenpairs.  
+
+Parameters
+----------
+* tolerance :  
+    the outer tolerance (> 0)  
+";
+
 // File: classLattice.xml
 
 
@@ -3318,17 +3822,25 @@ the distance to the nearest Lattice cell boundary
 ";
 
 %feature("docstring") Lattice::findCell "
-findCell(LocalCoords *coords) -> Cell *  
+findCell(LocalCoords *coords, bool moved=false, bool strict=false) -> Cell *  
 
 Finds the Cell within this Lattice that a LocalCoords is in.  
 
 This method first find the Lattice cell, then searches the Universe inside that Lattice
-cell. If LocalCoords is outside the bounds of the Lattice, this method will return NULL.  
+cell. If LocalCoords is outside the bounds of the Lattice, this method will return NULL.
+If the coords were moved a short distance and remain in the same Lattice cell, the
+Universe inside it is told to check the Cell the coords were previously in first.  
 
 Parameters
 ----------
 * coords :  
     the LocalCoords of interest  
+* moved :  
+    whether the coords were moved across at most one Surface, or any distance if the
+    search is strict, since they were last found in this Lattice  
+* strict :  
+    whether the Cells the coords were previously in are only kept for coords which are
+    not on their Surfaces  
 
 Returns
 -------
@@ -3887,6 +4399,47 @@ prune()
 Removes and frees memory for all LocalCoords beyond this one in the linked list.  
 ";
 
+%feature("docstring") LocalCoords::setLevels "
+setLevels(LocalCoords *levels, int num_levels)  
+
+Sets an array of LocalCoords to use for the levels below this one.  
+
+The LocalCoords at the next lower level is taken from the first element of the array, the
+one below that from the second element, and so on. Levels beyond the end of the array are
+allocated on the heap. An array sized to Geometry::getMaxNestingDepth() allows ray tracing
+without touching the heap. The array must outlive the linked list of LocalCoords.  
+
+Parameters
+----------
+* levels :  
+    an array of LocalCoords, or NULL to use the heap  
+* num_levels :  
+    the number of LocalCoords in the array  
+";
+
+%feature("docstring") LocalCoords::getNextCreate "
+getNextCreate(double x, double y, double z) -> LocalCoords *  
+
+Returns the LocalCoords at the next lower level, creating it if there is none, and sets its
+coordinates.  
+
+A new LocalCoords is taken from the array of lower levels if one was set with setLevels()
+and is allocated on the heap otherwise.  
+
+Parameters
+----------
+* x :  
+    the x-coordinate of the next lower level  
+* y :  
+    the y-coordinate of the next lower level  
+* z :  
+    the z-coordinate of the next lower level  
+
+Returns
+-------
+a pointer to the LocalCoords at the next lower level  
+";
+
 %feature("docstring") LocalCoords::setNext "
 setNext(LocalCoords *next)  
 
@@ -4075,8 +4628,9 @@ Parameters
 copyCoords(LocalCoords *coords)  
 
 Copies a LocalCoords' values to this one. details Given a pointer to a LocalCoords, it
-first prunes it and then creates a copy of the linked list of LocalCoords in the linked
-list below this one to give to the input LocalCoords.  
+copies the linked list of LocalCoords below this one into the linked list of the input
+LocalCoords, reusing its existing levels, creating any missing levels and deleting any
+extra levels.  
 
 Parameters
 ----------
@@ -4317,6 +4871,43 @@ section vectors. This routine is intended for internal use and is called by the
 runtime.  
 ";
 
+%feature("docstring") Material::buildScatterBands "
+buildScatterBands()  
+
+Finds the band of groups which scatter into each energy group.  
+
+Multigroup scattering matrices are mostly downscatter with a narrow band of upscatter, such
+that most of the groups do not scatter into a given group. For each destination group,
+this method finds the first and one past the last origin group with a non-zero scattering
+cross-section, so that the scattering source may be summed over the band alone. A group
+into which no group scatters has an empty band. The bands must be rebuilt if the
+scattering matrix is modified or transposed.  
+";
+
+%feature("docstring") Material::getScatterBandStart "
+getScatterBandStart() -> int *  
+
+Return the first group which scatters into each energy group.  
+
+The scattering bands are built by buildScatterBands().  
+
+Returns
+-------
+the pointer to the first source group of each energy group  
+";
+
+%feature("docstring") Material::getScatterBandEnd "
+getScatterBandEnd() -> int *  
+
+Return one past the last group which scatters into each energy group.  
+
+The scattering bands are built by buildScatterBands().  
+
+Returns
+-------
+the pointer to one past the last source group of each group  
+";
+
 %feature("docstring") Material::getId "
 getId() const  -> int  
 
@@ -5244,6 +5835,22 @@ Returns
 number of locks in the map  
 ";
 
+%feature("docstring") ParallelHashMap::setNumThreads "
+setNumThreads(int num_threads)  
+
+Sets the number of threads which may access the parallel hash map.  
+
+Each thread announces the table it is reading in its own entry of the announce array, so
+the array must have an entry for every thread. The number of threads is taken from OpenMP
+when the map is constructed, which may be before the number of threads is set by the
+user. This method must not be called while other threads are accessing the map.  
+
+Parameters
+----------
+* num_threads :  
+    the number of threads which may access the map  
+";
+
 %feature("docstring") ParallelHashMap::contains "
 contains(K key) -> bool  
 
@@ -6167,6 +6774,124 @@ This routine is used by the Solver::computeEigenvalue(...) routine which uses th
 of fissionable FSRs to normalize the residual on the fission source distribution.  
 ";
 
+%feature("docstring") Solver::initializeXSTable "
+initializeXSTable()  
+
+Copies the cross sections of each Material into the solver's cross-section table.  
+
+The total, nu-fission, scattering and fission matrix cross sections of each Material are
+stored contiguously in a 64-byte aligned block of the table, and each FSR stores the index
+of its Material's block. This allows the source, residual and eigenvalue kernels to read
+the cross sections from flat arrays rather than through the checked Material accessors. If
+the Solver pads the energy groups, the padding has a total cross section of one and zero
+for the other cross sections. The band of groups which scatter into each group is stored
+alongside the table, or all groups if sparse scattering is not in use. The table is
+rebuilt by each call to initializeMaterials(...).  
+";
+
+%feature("docstring") Solver::setSparseScattering "
+setSparseScattering(bool sparse_scattering)  
+
+Sets whether the scattering sources are summed over the band of groups which scatter into
+each group.  
+
+By default, the scattering source into each group is summed over the band of groups
+between the first and the last group which scatter into it, as found by
+Material::buildScatterBands(). Otherwise, it is summed over all groups, which is useful to
+measure the cost of the dense scattering matrix. The setting takes effect when the
+Materials are next initialized.  
+
+Parameters
+----------
+* sparse_scattering :  
+    whether to use the scattering bands (true) or not  
+";
+
+%feature("docstring") Solver::isUsingSparseScattering "
+isUsingSparseScattering() -> bool  
+
+Returns whether the scattering sources are summed over the band of groups which scatter
+into each group.  
+
+Returns
+-------
+true if sparse scattering is in use (default), false otherwise  
+";
+
+%feature("docstring") Solver::setAcceleration "
+setAcceleration(accelerationType acceleration)  
+
+Sets the accelerator of the outer source iterations which computeEigenvalue() applies to
+the power iteration.  
+
+ANDERSON and CHEBYSHEV combine each iteration's scalar flux with those of the previous
+iterations, while WIELANDT shifts part of the fission source into inner source iterations.
+Accelerators are not applied if a Cmfd updates the flux. The accelerator may be changed
+between calls to computeEigenvalue() as follows:  
+
+
+         solver.setAcceleration(openmoc.ANDERSON)
+         solver.computeEigenvalue()
+         print(solver.getNumIterations(), solver.getTotalTime())  
+
+Parameters
+----------
+* acceleration :  
+    the accelerator type (NO_ACCELERATION by default)  
+";
+
+%feature("docstring") Solver::getAcceleration "
+getAcceleration() -> accelerationType  
+
+Returns the accelerator of the outer eigenvalue iterations.  
+
+Returns
+-------
+the accelerator type (NO_ACCELERATION by default)  
+";
+
+%feature("docstring") Solver::setAndersonDepth "
+setAndersonDepth(int depth)  
+
+Sets the number of previous iterations mixed by the ANDERSON accelerator.  
+
+Each iteration of history stores two copies of the scalar and Track angular fluxes.  
+
+Parameters
+----------
+* depth :  
+    the number of previous iterations (5 by default)  
+";
+
+%feature("docstring") Solver::setChebyshevCycleLength "
+setChebyshevCycleLength(int length)  
+
+Sets the number of extrapolated iterations in each cycle of the CHEBYSHEV accelerator.  
+
+Parameters
+----------
+* length :  
+    the number of extrapolated iterations (10 by default)  
+";
+
+%feature("docstring") Solver::setWielandtShift "
+setWielandtShift(FP_PRECISION shift, int num_inner_iterations=2)  
+
+Sets the eigenvalue shift of the WIELANDT accelerator.  
+
+Each outer iteration moves the fission source of the shift eigenvalue k_s = k_eff + delta
+into the operator and converges it with a number of inner source iterations. A smaller
+shift reduces the number of outer iterations but slows the convergence of the inner
+iterations.  
+
+Parameters
+----------
+* shift :  
+    the difference delta between the shift and the eigenvalue (0.5 by default)  
+* num_inner_iterations :  
+    the number of inner source iterations for each outer iteration (2 by default)  
+";
+
 %feature("docstring") Solver::setExpPrecision "
 setExpPrecision(FP_PRECISION precision)  
 
@@ -6623,6 +7348,19 @@ Returns
 the number of iterations  
 ";
 
+%feature("docstring") Solver::getNumTransportSweeps "
+getNumTransportSweeps() -> int  
+
+Returns the number of transport sweeps to converge the source.  
+
+This is larger than the number of source iterations with the WIELANDT accelerator, which
+sweeps several inner iterations for each outer iteration.  
+
+Returns
+-------
+the number of transport sweeps  
+";
+
 %feature("docstring") Solver::storeFSRFluxes "
 storeFSRFluxes()=0  
 
@@ -8515,23 +9253,63 @@ Parameters
 ";
 
 %feature("docstring") Universe::findCell "
-findCell(LocalCoords *coords) -> Cell *  
+findCell(LocalCoords *coords, bool moved=false, bool strict=false) -> Cell *  
 
 Finds the Cell for which a LocalCoords object resides.  
 
 Finds the Cell that a LocalCoords object is located inside by checking each of this
-Universe's Cells. Returns NULL if the LocalCoords is not in any of the Cells.  
+Universe's Cells. Returns NULL if the LocalCoords is not in any of the Cells. The
+LocalCoords at lower levels in the linked list are reused if present and any below the
+Material-filled Cell which is found are deleted.  
+
+If the coords were moved a short distance along a Track from where they were last found,
+the Cell they were previously in is checked first. If the coords remain in it, the lower
+levels are searched in the same way. Otherwise only the neighbors of the previous Cell, or
+the Cells in the grid bin containing the coords if fewer, are searched.  
+
+If the search is strict, the coords may have been moved any distance. The previous Cell is
+only kept if the coords are inside it and not on any of its Surfaces, and otherwise the
+Cells are searched as if the coords were new. The Cell found is then always the same as
+that found by a search from scratch.  
 
 Parameters
 ----------
 * coords :  
     a pointer to the LocalCoords of interest  
+* moved :  
+    whether the coords were moved across at most one Surface, or any distance if the
+    search is strict, since they were last found in a Cell of this Universe  
+* strict :  
+    whether the previous Cell is only kept for coords which are not on its Surfaces  
 
 Returns
 -------
 a pointer the Cell where the LocalCoords is located  
 ";
 
+%feature("docstring") Universe::buildCellIndex "
+buildCellIndex()  
+
+Builds the index used by findCell() to cull Cells which cannot contain a
+LocalCoords.  
+
+The index stores a padded bounding box for each Cell. Universes with more than
+CELL_GRID_MIN_CELLS Cells also overlay a uniform grid on the finite extent of the
+boxes, with each bin listing the Cells whose boxes overlap it, and list the neighbors of
+each Cell whose boxes overlap its own. Cells are always
+tested in ascending ID order so the index never changes which Cell is found. This
+method is called for every Universe by Geometry::initializeFSRs() once the Cells
+have been subdivided. The index is discarded when a Cell is added or removed and
+must be rebuilt if the Surfaces of the Universe's Cells are modified.  
+";
+
+%feature("docstring") Universe::clearCellIndex "
+clearCellIndex()  
+
+Discards the Cell bounding boxes and grid so that findCell() tests every Cell in
+the Universe.  
+";
+
 %feature("docstring") Universe::getCell "
 getCell(int cell_id) -> Cell *  
 
@@ -22,6 +22,11 @@ class IRAMSolver(object):
     n highest order eigenvalues/vectors for a k-eigenvalue criticality problem.
     This functionality is based on original work by Colin Josey (cjosey@mit.edu).
 
+    The eigenmodes are computed in C++ by an openmoc.KrylovSolver, which
+    applies the transport operators on the MOC solver's own flux arrays. The
+    SciPy implementation is used for the GPUSolver and for inner methods other
+    than GMRES.
+
     NOTE: This functionality only works for vacuum boundary conditions.
 
     """
@@ -70,6 +75,7 @@ class IRAMSolver(object):
         self._m_count = None
         self._eigenvalues = None
         self._eigenvectors = None
+        self._krylov_solver = None
 
     def computeEigenmodes(self, solver_mode=openmoc.FORWARD, num_modes=5,
                           inner_method='gmres', outer_tol=1e-5,
@@ -101,13 +107,18 @@ class IRAMSolver(object):
             py_printf('ERROR', 'All boundary conditions must be ' + \
                       'VACUUM for the IRAMSolver')
 
-        import scipy.sparse.linalg as linalg
-
         # Set solution-dependent class attributes based on parameters
         # These are accessed and used by the LinearOperators
         self._num_modes = num_modes
         self._outer_tol = outer_tol
 
+        # Solve the eigenvalue problem in C++ on the MOC solver's fluxes
+        if not self._with_cuda and inner_method == 'gmres':
+            self._computeNativeEigenmodes(solver_mode, inner_tol)
+            return
+
+        import scipy.sparse.linalg as linalg
+
         self.initializeOperators(solver_mode, inner_method, inner_tol, interval)
 
         # Solve the eigenvalue problem
@@ -132,6 +143,38 @@ class IRAMSolver(object):
         # Restore the material data
         self._moc_solver.resetMaterials(solver_mode)
 
+    def _computeNativeEigenmodes(self, solver_mode, inner_tol):
+        """Private routine to compute the eigenmodes with a KrylovSolver.
+
+        Parameters
+        ----------
+        solver_mode : {openmoc.FORWARD, openmoc.ADJOINT}
+            The type of eigenmodes to compute
+        inner_tol : Real
+            The tolerance on the inner Ax=b solve
+
+        """
+
+        self._krylov_solver = openmoc.KrylovSolver(self._moc_solver)
+        self._krylov_solver.setNumModes(self._num_modes)
+        self._krylov_solver.setOuterTolerance(self._outer_tol)
+        self._krylov_solver.setInnerTolerance(inner_tol)
+        self._krylov_solver.computeEigenmodes(solver_mode)
+
+        self._a_count = self._krylov_solver.getNumScatterSweeps()
+        self._m_count = self._krylov_solver.getNumFissionSweeps()
+
+        # Store the eigenvalues and eigenvectors
+        self._eigenvalues = np.zeros(self._num_modes, dtype=np.complex128)
+        self._eigenvectors = np.zeros((self._op_size, self._num_modes))
+
+        for mode in range(self._num_modes):
+            self._eigenvalues[mode] = complex(
+                self._krylov_solver.getEigenvalue(mode),
+                self._krylov_solver.getEigenvalueImag(mode))
+            self._eigenvectors[:, mode] = \
+                self._krylov_solver.getEigenvector(mode, self._op_size)
+
     def initializeOperators(self, solver_mode=openmoc.FORWARD,
                             inner_method='gmres', inner_tol=1e-6, interval=10):
         """Initialize the operators M, A, and F.
@@ -599,7 +599,7 @@ def compute_sph_factors(mgxs_lib, max_sph_iters=30, sph_tol=1E-5,
             openmoc.set_log_level(log_level)
 
         # Extract the FSR scalar fluxes
-        fsr_fluxes = get_scalar_fluxes(solver)
+        fsr_fluxes = get_scalar_fluxes(solver, copy=False)
 
         # Compute the domain-averaged flux in each energy group
         for j, openmc_domain in enumerate(mgxs_lib.domains):
@@ -55,6 +55,12 @@
  * getCellIds method for the data processing routines in openmoc.process */
 %apply (int* ARGOUT_ARRAY1, int DIM1) {(int* cell_ids, int num_cells)}
 
+/* The typemaps used to match the method signature for the Geometry's
+ * findDomainsAtPoints method for the plotting and data processing routines
+ * in openmoc.plotter and openmoc.process */
+%apply (double* IN_ARRAY2, int DIM1, int DIM2) {(double* points, int num_points, int num_dims)}
+%apply (int* ARGOUT_ARRAY1, int DIM1) {(int* domains, int num_domains)}
+
 /* The typemap used to match the method signature for the
  * PolarQuad::setSinThetas method. This allows users to set the polar angle
  * quadrature sine thetas using a NumPy array */
@@ -70,3 +76,65 @@
 
 /* The typemap used to match the method signature for Solver::setFluxes */
 %apply (FP_PRECISION* INPLACE_ARRAY1, int DIM1) {(FP_PRECISION* in_fluxes, int num_fluxes)}
+
+/* The typemap used to match the method signature for
+ * KrylovSolver::getEigenvector */
+%apply (double* ARGOUT_ARRAY1, int DIM1) {(double* eigenvector, int num_fluxes)}
+
+/* The typemaps used to match the method signatures for the Solver's
+ * getFluxesView, getReducedSourcesView and getFSRVolumesView methods. These
+ * return NumPy arrays which share their memory with the Solver */
+%apply (FP_PRECISION** ARGOUTVIEW_ARRAY2, int* DIM1, int* DIM2) {(FP_PRECISION** view, int* num_FSRs, int* num_groups)}
+%apply (FP_PRECISION** ARGOUTVIEW_ARRAY1, int* DIM1) {(FP_PRECISION** view, int* num_FSRs)}
+
+/* The raw views do not reference the Solver which owns their memory. They are
+ * wrapped in Python to keep the Solver alive as long as any view of its
+ * arrays exists, and to make the views read-only unless requested otherwise */
+%rename(_getFluxesView) Solver::getFluxesView;
+%rename(_getReducedSourcesView) Solver::getReducedSourcesView;
+%rename(_getFSRVolumesView) Solver::getFSRVolumesView;
+
+%pythoncode %{
+import numpy as _numpy
+
+class _SolverArrayView(object):
+    """Holds a view of a Solver's array along with a reference to the Solver"""
+
+    def __init__(self, array, owner):
+        self.__array_interface__ = array.__array_interface__
+        self._array = array
+        self._owner = owner
+
+def _solver_array_view(array, owner, writable):
+    view = _numpy.asarray(_SolverArrayView(array, owner))
+    view.flags.writeable = writable
+    return view
+%}
+
+%extend Solver {
+  %pythoncode %{
+    def getFluxesView(self, writable=False):
+        """Return a NumPy view of the FSR scalar fluxes indexed by FSR and group.
+
+        The view shares its memory with the Solver and is only valid until the
+        fluxes are reallocated by the next calculation. Note that the number of
+        groups may be padded for vector alignment by the VectorizedSolver.
+        """
+        return _solver_array_view(self._getFluxesView(), self, writable)
+
+    def getReducedSourcesView(self, writable=False):
+        """Return a NumPy view of the FSR reduced sources indexed by FSR and group.
+
+        The view shares its memory with the Solver and is only valid until the
+        sources are reallocated by the next calculation.
+        """
+        return _solver_array_view(self._getReducedSourcesView(), self, writable)
+
+    def getFSRVolumesView(self, writable=False):
+        """Return a NumPy view of the FSR volumes.
+
+        The view shares its memory with the TrackGenerator used by the Solver.
+        """
+        return _solver_array_view(self._getFSRVolumesView(), self, writable)
+  %}
+}
@@ -25,6 +25,7 @@
   #include "../src/Quadrature.h"
   #include "../src/Solver.h"
   #include "../src/CPUSolver.h"
+  #include "../src/KrylovSolver.h"
   #include "../src/boundary_type.h"
   #include "../src/Surface.h"
   #include "../src/Timer.h"
@@ -36,7 +37,7 @@
   #include "../src/Matrix.h"
   #include "../src/linalg.h"
 
-  #ifdef ICPC
+  #ifndef BGXLC
   #include "../src/VectorizedSolver.h"
   #endif
 
@@ -72,6 +73,7 @@
 %ignore setFSRsToMaterialIDs(std::vector<int>* FSRs_to_material_IDs);
 %ignore setFSRKeysMap(ParallelHashMap<std::size_t, fsr_data*>* FSR_keys_map);
 %ignore initializeFSRVectors();
+%ignore initializeFSRIndex();
 
 /* Instruct SWIG to ignore methods used in getting CSR Matrix format and Vector
  * attributes. These attributes should be used internally only by the Matrix and
@@ -121,6 +123,7 @@ namespace std {
 %include ../src/Quadrature.h
 %include ../src/Solver.h
 %include ../src/CPUSolver.h
+%include ../src/KrylovSolver.h
 %include ../src/boundary_type.h
 %include ../src/Surface.h
 %include ../src/Timer.h
@@ -133,7 +136,7 @@ namespace std {
 %include ../src/Matrix.h
 %include ../src/linalg.h
 
-#ifdef ICPC
+#ifndef BGXLC
 %include ../src/VectorizedSolver.h
 #endif
 
@@ -654,7 +654,7 @@ def plot_spatial_fluxes(solver, energy_groups=[1], norm=False, gridsize=250,
     plot_params.norm = norm
 
     # Get array of FSR energy-dependent fluxes
-    fluxes = get_scalar_fluxes(solver)
+    fluxes = get_scalar_fluxes(solver, copy=False)
 
     # Initialize an empty list of Matplotlib figures if requestd by the user
     figures = []
@@ -752,15 +752,14 @@ def plot_energy_fluxes(solver, fsrs, group_bounds=None, norm=True,
     # Initialize an empty list of Matplotlib figures if requestd by the user
     figures = []
 
+    # Get array of FSR energy-dependent fluxes
+    all_fluxes = get_scalar_fluxes(solver, copy=False)
+
     # Iterate over all flat source regions
     for fsr in fsrs:
 
-        # Allocate memory for an array of this FSR's fluxes
-        fluxes = np.zeros(num_groups, dtype=np.float)
-
-        # Extract the flux in each energy group
-        for group in range(num_groups):
-            fluxes[group] = solver.getFlux(fsr, group+1)
+        # Copy this FSR's fluxes in each energy group
+        fluxes = np.array(all_fluxes[fsr, :], dtype=np.float)
 
         # Normalize fluxes to the total integrated flux
         if norm:
@@ -25,6 +25,7 @@ else:
 
 # Store viable OpenMOC solver types for type checking
 solver_types = (openmoc.Solver,)
+gpu_solver_types = ()
 try:
     # Try to import OpenMOC's CUDA module
     if (sys.version_info[0] == 2):
@@ -32,6 +33,7 @@ try:
     else:
         from openmoc.cuda import GPUSolver
     solver_types += (GPUSolver,)
+    gpu_solver_types += (GPUSolver,)
 except ImportError:
     pass
 
@@ -39,7 +41,7 @@ if sys.version_info[0] >= 3:
     basestring = str
 
 
-def get_scalar_fluxes(solver, fsrs='all', groups='all'):
+def get_scalar_fluxes(solver, fsrs='all', groups='all', copy=True):
     """Return an array of scalar fluxes in one or more FSRs and groups.
 
     This routine builds a 2D NumPy array indexed by FSR and energy group for
@@ -57,6 +59,11 @@ def get_scalar_fluxes(solver, fsrs='all', groups='all'):
         A collection of integer FSR IDs or 'all' (default)
     groups : Iterable of Integral or 'all'
         A collection of integer energy groups or 'all' (default)
+    copy : bool
+        Whether to return a copy of the fluxes (default) or, if 'all' FSRs
+        and groups are requested from a CPU solver, a read-only view which
+        shares its memory with the solver and is overwritten by its next
+        calculation
 
     Returns
     -------
@@ -80,36 +87,33 @@ def get_scalar_fluxes(solver, fsrs='all', groups='all'):
     else:
         cv.check_type('groups', Iterable, Integral)
 
-    # Extract all of the FSR scalar fluxes
-    if groups == 'all' and fsrs == 'all':
-        num_fsrs = solver.getGeometry().getNumFSRs()
-        num_groups = solver.getGeometry().getNumEnergyGroups()
-        num_fluxes = num_groups * num_fsrs
-        fluxes = solver.getFluxes(num_fluxes)
+    num_fsrs = solver.getGeometry().getNumFSRs()
+    num_groups = solver.getGeometry().getNumEnergyGroups()
+
+    # Extract all of the FSR scalar fluxes, sliced to remove any padding of
+    # the energy groups by the VectorizedSolver. The fluxes of a GPUSolver
+    # are copied from the device since they cannot be viewed.
+    if isinstance(solver, gpu_solver_types):
+        fluxes = solver.getFluxes(num_fsrs * num_groups)
         fluxes = np.reshape(fluxes, (num_fsrs, num_groups))
-        return fluxes
+    else:
+        fluxes = solver.getFluxesView()[:, :num_groups]
+
+    if groups == 'all' and fsrs == 'all':
+        return np.array(fluxes) if copy else fluxes
 
-    # Build a list of FSRs to iterate over
+    # Build a list of FSRs to extract
     if fsrs == 'all':
-        num_fsrs = solver.getGeometry().getNumFSRs()
         fsrs = np.arange(num_fsrs)
-    else:
-        num_fsrs = len(fsrs)
 
-    # Build a list of enery groups to iterate over
+    # Build a list of enery groups to extract
     if groups == 'all':
-        num_groups = solver.getGeometry().getNumEnergyGroups()
         groups = np.arange(num_groups) + 1
-    else:
-        num_groups = len(groups)
 
     # Extract some of the FSR scalar fluxes
-    fluxes = np.zeros((num_fsrs, num_groups))
-    for fsr in fsrs:
-        for group in groups:
-            fluxes[fsr, group-1] = solver.getFlux(int(fsr), int(group))
-
-    return fluxes
+    fsrs = np.asarray(fsrs, dtype=int)
+    groups = np.asarray(groups, dtype=int)
+    return fluxes[np.ix_(fsrs, groups - 1)].astype(np.float64)
 
 
 def compute_fission_rates(solver, use_hdf5=False):
@@ -363,13 +367,8 @@ def store_simulation_state(solver, fluxes=False, sources=False,
     # If the user requested to store the FSR fluxes
     if fluxes:
 
-        # Allocate array
-        scalar_fluxes = np.zeros((num_FSRs, num_groups))
-
-        # Get the scalar flux for each FSR and energy group
-        for i in range(num_FSRs):
-            for j in range(num_groups):
-                scalar_fluxes[i,j] = solver.getFlux(i,j+1)
+        # Copy the scalar flux for each FSR and energy group
+        scalar_fluxes = get_scalar_fluxes(solver)
 
     # If the user requested to store the FSR sources
     if sources:
@@ -971,13 +970,23 @@ class Mesh(object):
             cv.check_type('domains_to_coeffs',
                           domains_to_coeffs, (dict, np.ndarray))
 
-        # Extract the FSR fluxes from the Solver
-        fluxes = get_scalar_fluxes(solver)
+        # Extract the FSR fluxes and volumes from the Solver
+        fluxes = get_scalar_fluxes(solver, copy=False)
+        volumes = solver.getFSRVolumesView()
 
         # Initialize a 2D or 3D NumPy array in which to tally
         tally_shape = tuple(self.dimension) + (num_groups,)
         tally = np.zeros(tally_shape, dtype=np.float)
 
+        # Find the Cell and Material at each FSR's point in a single query
+        if domain_type != 'fsr':
+            points = np.zeros((num_fsrs, 3))
+            for fsr in range(num_fsrs):
+                point = geometry.getFSRPoint(fsr)
+                points[fsr, :] = [point.getX(), point.getY(), point.getZ()]
+            domains = geometry.findDomainsAtPoints(points, 3 * num_fsrs)
+            domains = np.reshape(domains, (num_fsrs, 3))
+
         # Compute product of fluxes with domains-to-coeffs mapping by group, FSR
         for fsr in range(num_fsrs):
             point = geometry.getFSRPoint(fsr)
@@ -986,21 +995,16 @@ class Mesh(object):
             if np.nan in mesh_indices:
                 continue
 
-            volume = solver.getFSRVolume(fsr)
+            volume = volumes[fsr]
             fsr_tally = np.zeros(num_groups, dtype=np.float)
 
             # Determine domain ID (material, cell or FSR) for this FSR
             if domain_type == 'fsr':
                 domain_id = fsr
+            elif domain_type == 'cell':
+                domain_id = domains[fsr, 1]
             else:
-                coords = \
-                    openmoc.LocalCoords(point.getX(), point.getY(), point.getZ())
-                coords.setUniverse(geometry.getRootUniverse())
-                cell = geometry.findCellContainingCoords(coords)
-                if domain_type == 'cell':
-                    domain_id = cell.getId()
-                else:
-                    domain_id = cell.getFillMaterial().getId()
+                domain_id = domains[fsr, 2]
 
             # Tally flux multiplied by coefficients by energy group
             for group in range(num_groups):
@@ -0,0 +1,762 @@
+/**
+ * @file benchmark.cpp
+ * @brief A micro-benchmark of the OpenMOC transport sweep.
+ * @details The benchmark generates Tracks for the C5G7 or a synthetic
+ *          geometry, converges the source for a few warm-up iterations and
+ *          then times a configurable number of transport sweeps. The sweep
+ *          throughput, the estimated memory traffic, the threading
+ *          efficiency and optionally hardware counters are written as JSON
+ *          so that the performance may be tracked across versions. With
+ *          --kernel sources, the FSR source update is timed instead with
+ *          dense and sparse scattering, and with --kernel eigenvalue, the
+ *          eigenvalue is converged with each outer iteration accelerator.
+ *          Run the benchmark with --help for a list of options.
+ */
+
+#include "geometries.h"
+#include "perf_counters.h"
+#include "../../src/CPUSolver.h"
+#include "../../src/VectorizedSolver.h"
+#include "../../src/TrackGenerator.h"
+#include "../../src/log.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#ifndef OPENMOC_GIT_REVISION
+#define OPENMOC_GIT_REVISION "unknown"
+#endif
+
+
+/**
+ * @struct BenchmarkOptions
+ * @brief The options of the transport sweep benchmark.
+ */
+struct BenchmarkOptions {
+
+  /** The kernel to time ("sweep", "sources" or "eigenvalue") */
+  std::string _kernel;
+
+  /** The geometry to sweep ("c5g7" or "synthetic") */
+  std::string _geometry;
+
+  /** The number of energy groups of the synthetic geometry */
+  int _num_groups;
+
+  /** The number of pins along each side of the synthetic geometry */
+  int _lattice_width;
+
+  /** The number of azimuthal angles */
+  int _num_azim;
+
+  /** The azimuthal ray spacing (cm) */
+  double _azim_spacing;
+
+  /** The number of source iterations before the timed sweeps */
+  int _num_warmup;
+
+  /** The number of timed transport sweeps */
+  int _num_sweeps;
+
+  /** The convergence threshold of the eigenvalue calculations */
+  double _tolerance;
+
+  /** The maximum number of iterations of the eigenvalue calculations */
+  int _max_iters;
+
+  /** The number of OpenMP threads */
+  int _num_threads;
+
+  /** The solver ("cpu" or "vectorized") */
+  std::string _solver;
+
+  /** The flux accumulation ("locks", "private" or "atomic") */
+  std::string _accumulation;
+
+  /** The exponential evaluation ("table" or "intrinsic") */
+  std::string _exponentials;
+
+  /** The exponential cache ("none", "full", "single" or "fixed16") */
+  std::string _exp_cache;
+
+  /** Whether the FSR scalar fluxes are tallied in double precision */
+  bool _mixed_precision;
+
+  /** Whether the sweeps are repeated with one thread */
+  bool _scaling;
+
+  /** Whether hardware counters are read */
+  bool _perf;
+
+  /** The JSON output file, or standard output if empty */
+  std::string _output;
+
+  /** The OpenMOC log level */
+  std::string _log_level;
+};
+
+
+/**
+ * @brief Prints the benchmark's command line options.
+ */
+static void printUsage() {
+  std::cout <<
+    "Usage: openmoc-benchmark [options]\n"
+    "  --kernel NAME         sweep (default), sources or eigenvalue\n"
+    "  --geometry NAME       c5g7 (default) or synthetic\n"
+    "  --groups N            energy groups of the synthetic geometry (7)\n"
+    "  --lattice N           pins per side of the synthetic geometry (17)\n"
+    "  --azim N              number of azimuthal angles (4)\n"
+    "  --spacing D           azimuthal ray spacing in cm (0.1)\n"
+    "  --warmup N            source iterations before timing (2)\n"
+    "  --sweeps N            number of timed sweeps or source updates (20)\n"
+    "  --tolerance D         eigenvalue convergence threshold (1E-5)\n"
+    "  --max-iters N         maximum eigenvalue iterations (1000)\n"
+    "  --threads N           number of OpenMP threads (1)\n"
+    "  --solver NAME         cpu (default) or vectorized\n"
+    "  --accumulation NAME   locks (default), private or atomic\n"
+    "  --exponentials NAME   table (default) or intrinsic\n"
+    "  --exp-cache NAME      none (default), full, single or fixed16\n"
+    "  --mixed-precision     tally the scalar fluxes in double precision\n"
+    "  --scaling             repeat the sweeps with one thread\n"
+    "  --perf                read hardware counters with perf_event\n"
+    "  --output FILE         write the JSON results to FILE\n"
+    "  --log-level LEVEL     OpenMOC log level (ERROR)\n";
+}
+
+
+/**
+ * @brief Parses the benchmark's command line options.
+ * @param argc the number of command line arguments
+ * @param argv the command line arguments
+ * @return the benchmark options
+ */
+static BenchmarkOptions parseOptions(int argc, char** argv) {
+
+  BenchmarkOptions options;
+  options._kernel = "sweep";
+  options._geometry = "c5g7";
+  options._num_groups = 7;
+  options._lattice_width = 17;
+  options._num_azim = 4;
+  options._azim_spacing = 0.1;
+  options._num_warmup = 2;
+  options._num_sweeps = 20;
+  options._tolerance = 1.E-5;
+  options._max_iters = 1000;
+  options._num_threads = 1;
+  options._solver = "cpu";
+  options._accumulation = "locks";
+  options._exponentials = "table";
+  options._exp_cache = "none";
+  options._mixed_precision = false;
+  options._scaling = false;
+  options._perf = false;
+  options._log_level = "ERROR";
+
+  for (int i=1; i < argc; i++) {
+
+    std::string option = argv[i];
+
+    /* Options without a value */
+    if (option == "--help" || option == "-h") {
+      printUsage();
+      exit(0);
+    }
+    else if (option == "--mixed-precision") {
+      options._mixed_precision = true;
+      continue;
+    }
+    else if (option == "--scaling") {
+      options._scaling = true;
+      continue;
+    }
+    else if (option == "--perf") {
+      options._perf = true;
+      continue;
+    }
+
+    /* Options with a value */
+    if (i+1 >= argc) {
+      std::cerr << "Missing value for option " << option << "\n";
+      exit(1);
+    }
+
+    std::string value = argv[++i];
+
+    if (option == "--kernel")
+      options._kernel = value;
+    else if (option == "--geometry")
+      options._geometry = value;
+    else if (option == "--groups")
+      options._num_groups = atoi(value.c_str());
+    else if (option == "--lattice")
+      options._lattice_width = atoi(value.c_str());
+    else if (option == "--azim")
+      options._num_azim = atoi(value.c_str());
+    else if (option == "--spacing")
+      options._azim_spacing = atof(value.c_str());
+    else if (option == "--warmup")
+      options._num_warmup = atoi(value.c_str());
+    else if (option == "--sweeps")
+      options._num_sweeps = atoi(value.c_str());
+    else if (option == "--tolerance")
+      options._tolerance = atof(value.c_str());
+    else if (option == "--max-iters")
+      options._max_iters = atoi(value.c_str());
+    else if (option == "--threads")
+      options._num_threads = atoi(value.c_str());
+    else if (option == "--solver")
+      options._solver = value;
+    else if (option == "--accumulation")
+      options._accumulation = value;
+    else if (option == "--exponentials")
+      options._exponentials = value;
+    else if (option == "--exp-cache")
+      options._exp_cache = value;
+    else if (option == "--output")
+      options._output = value;
+    else if (option == "--log-level")
+      options._log_level = value;
+    else {
+      std::cerr << "Unknown option " << option << "\n";
+      printUsage();
+      exit(1);
+    }
+  }
+
+  if (options._kernel != "sweep" && options._kernel != "sources" &&
+      options._kernel != "eigenvalue") {
+    std::cerr << "Unknown kernel " << options._kernel << "\n";
+    exit(1);
+  }
+
+  if (options._geometry != "c5g7" && options._geometry != "synthetic") {
+    std::cerr << "Unknown geometry " << options._geometry << "\n";
+    exit(1);
+  }
+
+  if (options._num_sweeps <= 0 || options._num_threads <= 0 ||
+      options._num_groups <= 0 || options._lattice_width <= 0 ||
+      options._max_iters <= 0) {
+    std::cerr << "The number of sweeps, threads, groups, pins and "
+              << "iterations must be positive\n";
+    exit(1);
+  }
+
+  return options;
+}
+
+
+/**
+ * @brief Returns a string quoted and escaped for JSON.
+ * @param value the string to quote
+ * @return the JSON string
+ */
+static std::string jsonString(const std::string& value) {
+
+  std::string quoted = "\"";
+  for (size_t i=0; i < value.size(); i++) {
+    if (value[i] == '"' || value[i] == '\\')
+      quoted += '\\';
+    if (value[i] == '\n')
+      quoted += "\\n";
+    else
+      quoted += value[i];
+  }
+
+  return quoted + "\"";
+}
+
+
+/**
+ * @brief Returns the median of a list of times.
+ * @param times the times (seconds)
+ * @return the median time (seconds)
+ */
+static double median(std::vector<double> times) {
+
+  std::sort(times.begin(), times.end());
+  int n = times.size();
+
+  if (n % 2 == 1)
+    return times[n/2];
+  else
+    return 0.5 * (times[n/2-1] + times[n/2]);
+}
+
+
+/**
+ * @brief Estimates the bytes of data read and written by the sweep kernel
+ *        for each traversal of a Track segment.
+ * @details The estimate counts the segment's length, FSR ID and material
+ *          index, the total cross-sections (or the cached exponentials),
+ *          the reduced sources and the read and write of the FSR scalar
+ *          flux in each group. The Track's angular flux is assumed to stay
+ *          in cache along the Track.
+ * @param options the benchmark options
+ * @param num_groups the number of energy groups
+ * @param num_polar_2 the number of polar angles in each hemisphere
+ * @return the bytes read and written per segment traversal
+ */
+static double bytesPerSegment(BenchmarkOptions& options, int num_groups,
+                              int num_polar_2) {
+
+  double fp = sizeof(FP_PRECISION);
+  double bytes = fp + 2 * sizeof(int);
+
+  /* Total cross-sections or cached exponentials */
+  if (options._exp_cache == "none")
+    bytes += num_groups * fp;
+  else if (options._exp_cache == "fixed16")
+    bytes += num_polar_2 * num_groups * 2;
+  else if (options._exp_cache == "single")
+    bytes += num_polar_2 * num_groups * sizeof(float);
+  else
+    bytes += num_polar_2 * num_groups * fp;
+
+  /* Reduced sources */
+  bytes += num_groups * fp;
+
+  /* FSR scalar flux tallies */
+  double tally = options._mixed_precision ? sizeof(double) : fp;
+  bytes += 2 * num_groups * tally;
+
+  return bytes;
+}
+
+
+/**
+ * @brief Times a number of transport sweeps within source iterations.
+ * @details Only the transport sweeps are timed, and the hardware counters
+ *          only count events during the transport sweeps.
+ * @param solver the solver which sweeps the Tracks
+ * @param num_sweeps the number of transport sweeps
+ * @param counters the hardware counters, or NULL
+ * @return the time of each transport sweep (seconds)
+ */
+static std::vector<double> timeSweeps(CPUSolver* solver, int num_sweeps,
+                                      PerfCounters* counters) {
+
+  std::vector<double> times;
+
+  for (int i=0; i < num_sweeps; i++) {
+    solver->normalizeFluxes();
+    solver->computeFSRSources();
+
+    if (counters != NULL)
+      counters->enable();
+
+    double start = omp_get_wtime();
+    solver->transportSweep();
+    times.push_back(omp_get_wtime() - start);
+
+    if (counters != NULL)
+      counters->disable();
+
+    solver->addSourceToScalarFlux();
+    solver->computeKeff();
+    solver->storeFSRFluxes();
+  }
+
+  return times;
+}
+
+
+/**
+ * @brief Times the FSR source update with dense and sparse scattering.
+ * @details For each of the dense and the sparse scattering sources, the
+ *          Materials are initialized for a few source iterations and then
+ *          the FSR sources are computed a number of times. The throughput
+ *          of each and the mean width of the scattering bands are written
+ *          as JSON.
+ * @param options the benchmark options
+ * @param solver the solver which computes the FSR sources
+ * @param geometry the Geometry
+ * @return the JSON results
+ */
+static std::string benchmarkSources(BenchmarkOptions& options,
+                                    CPUSolver* solver, Geometry* geometry) {
+
+  const char* names[2] = {"dense", "sparse"};
+  double median_times[2];
+  int num_groups = geometry->getNumEnergyGroups();
+  long num_updates = (long)geometry->getNumFSRs() * num_groups;
+
+  for (int i=0; i < 2; i++) {
+
+    solver->setSparseScattering(i == 1);
+    solver->computeEigenvalue(std::max(options._num_warmup, 1));
+
+    std::vector<double> times;
+    for (int n=0; n < options._num_sweeps; n++) {
+      double start = omp_get_wtime();
+      solver->computeFSRSources();
+      times.push_back(omp_get_wtime() - start);
+    }
+
+    median_times[i] = median(times);
+  }
+
+  /* Find the mean width of the scattering bands over all Materials */
+  std::map<int, Material*> materials = geometry->getAllMaterials();
+  std::map<int, Material*>::iterator m_iter;
+  double band_width = 0.;
+  for (m_iter = materials.begin(); m_iter != materials.end(); ++m_iter) {
+    int* start = m_iter->second->getScatterBandStart();
+    int* end = m_iter->second->getScatterBandEnd();
+    for (int g=0; g < num_groups; g++)
+      band_width += end[g] - start[g];
+  }
+  band_width /= materials.size() * num_groups;
+
+  std::ostringstream json;
+  json.precision(8);
+
+  json << "{\n";
+  json << "  \"benchmark\": \"openmoc-sources\",\n";
+  json << "  \"version\": {\n";
+  json << "    \"revision\": " << jsonString(OPENMOC_GIT_REVISION) << ",\n";
+  json << "    \"precision\": "
+       << jsonString(sizeof(FP_PRECISION) == sizeof(double) ?
+                     "double" : "single") << ",\n";
+  json << "    \"compiler\": " << jsonString(__VERSION__) << "\n";
+  json << "  },\n";
+
+  json << "  \"configuration\": {\n";
+  json << "    \"geometry\": " << jsonString(options._geometry) << ",\n";
+  json << "    \"num_updates\": " << options._num_sweeps << ",\n";
+  json << "    \"num_threads\": " << options._num_threads << "\n";
+  json << "  },\n";
+
+  json << "  \"problem\": {\n";
+  json << "    \"num_fsrs\": " << geometry->getNumFSRs() << ",\n";
+  json << "    \"num_groups\": " << num_groups << ",\n";
+  json << "    \"num_materials\": " << materials.size() << ",\n";
+  json << "    \"mean_scatter_band_width\": " << band_width << "\n";
+  json << "  },\n";
+
+  for (int i=0; i < 2; i++) {
+    json << "  \"" << names[i] << "\": {\n";
+    json << "    \"median_update_time\": " << median_times[i] << ",\n";
+    json << "    \"fsr_group_updates_per_second\": "
+         << num_updates / median_times[i] << "\n";
+    json << "  },\n";
+  }
+
+  json << "  \"speedup\": " << median_times[0] / median_times[1] << "\n";
+  json << "}\n";
+
+  return json.str();
+}
+
+
+/**
+ * @brief Converges the eigenvalue with each outer iteration accelerator.
+ * @details The eigenvalue is computed without acceleration and with the
+ *          Anderson, Chebyshev and Wielandt accelerators using their
+ *          default settings. The number of iterations and transport sweeps,
+ *          the total time and the eigenvalue of each are written as JSON.
+ * @param options the benchmark options
+ * @param solver the solver which computes the eigenvalue
+ * @param geometry the Geometry
+ * @return the JSON results
+ */
+static std::string benchmarkEigenvalue(BenchmarkOptions& options,
+                                       CPUSolver* solver, Geometry* geometry) {
+
+  const char* names[4] = {"none", "anderson", "chebyshev", "wielandt"};
+  accelerationType accelerators[4] = {NO_ACCELERATION, ANDERSON, CHEBYSHEV,
+                                      WIELANDT};
+
+  std::ostringstream json;
+  json.precision(8);
+
+  json << "{\n";
+  json << "  \"benchmark\": \"openmoc-eigenvalue\",\n";
+  json << "  \"version\": {\n";
+  json << "    \"revision\": " << jsonString(OPENMOC_GIT_REVISION) << ",\n";
+  json << "    \"precision\": "
+       << jsonString(sizeof(FP_PRECISION) == sizeof(double) ?
+                     "double" : "single") << ",\n";
+  json << "    \"compiler\": " << jsonString(__VERSION__) << "\n";
+  json << "  },\n";
+
+  json << "  \"configuration\": {\n";
+  json << "    \"geometry\": " << jsonString(options._geometry) << ",\n";
+  json << "    \"solver\": " << jsonString(options._solver) << ",\n";
+  json << "    \"tolerance\": " << options._tolerance << ",\n";
+  json << "    \"max_iterations\": " << options._max_iters << ",\n";
+  json << "    \"num_threads\": " << options._num_threads << "\n";
+  json << "  },\n";
+
+  json << "  \"problem\": {\n";
+  json << "    \"num_fsrs\": " << geometry->getNumFSRs() << ",\n";
+  json << "    \"num_groups\": " << geometry->getNumEnergyGroups() << "\n";
+  json << "  },\n";
+
+  json << "  \"accelerators\": {\n";
+
+  solver->setConvergenceThreshold(options._tolerance);
+
+  for (int i=0; i < 4; i++) {
+
+    solver->setAcceleration(accelerators[i]);
+    solver->computeEigenvalue(options._max_iters);
+
+    json << "    \"" << names[i] << "\": {\n";
+    json << "      \"num_iterations\": " << solver->getNumIterations()
+         << ",\n";
+    json << "      \"num_transport_sweeps\": "
+         << solver->getNumTransportSweeps() << ",\n";
+    json << "      \"total_time\": " << solver->getTotalTime() << ",\n";
+    json << "      \"k_eff\": " << solver->getKeff() << "\n";
+    json << "    }" << (i < 3 ? "," : "") << "\n";
+  }
+
+  json << "  }\n";
+  json << "}\n";
+
+  return json.str();
+}
+
+
+/**
+ * @brief Writes the JSON results to the output file or standard output.
+ * @param options the benchmark options
+ * @param json the JSON results
+ */
+static void writeResults(BenchmarkOptions& options, const std::string& json) {
+
+  if (options._output.empty())
+    std::cout << json;
+  else {
+    std::ofstream output(options._output.c_str());
+    output << json;
+  }
+}
+
+
+int main(int argc, char** argv) {
+
+  BenchmarkOptions options = parseOptions(argc, argv);
+  set_log_level(options._log_level.c_str());
+  omp_set_num_threads(options._num_threads);
+
+  /* Create the geometry */
+  Geometry* geometry;
+  if (options._geometry == "c5g7")
+    geometry = buildC5G7Geometry();
+  else
+    geometry = buildSyntheticGeometry(options._num_groups,
+                                      options._lattice_width);
+
+  /* Generate the Tracks */
+  TrackGenerator track_generator(geometry, options._num_azim,
+                                 options._azim_spacing);
+  track_generator.setNumThreads(options._num_threads);
+  track_generator.generateTracks(false);
+
+  /* Create and configure the solver */
+  CPUSolver* solver;
+  if (options._solver == "vectorized")
+    solver = new VectorizedSolver(&track_generator);
+  else
+    solver = new CPUSolver(&track_generator);
+
+  solver->setNumThreads(options._num_threads);
+  solver->setConvergenceThreshold(1.E-30);
+
+  if (options._accumulation == "private")
+    solver->setFluxAccumulation(THREAD_PRIVATE);
+  else if (options._accumulation == "atomic")
+    solver->setFluxAccumulation(ATOMIC_UPDATES);
+
+  if (options._exponentials == "intrinsic")
+    solver->useExponentialIntrinsic();
+
+  if (options._exp_cache == "full")
+    solver->useExponentialCache(EXP_CACHE_FULL);
+  else if (options._exp_cache == "single")
+    solver->useExponentialCache(EXP_CACHE_SINGLE);
+  else if (options._exp_cache == "fixed16")
+    solver->useExponentialCache(EXP_CACHE_FIXED16);
+
+  if (options._mixed_precision)
+    solver->useMixedPrecision();
+
+  /* Time the FSR source update instead of the transport sweep */
+  if (options._kernel == "sources") {
+    writeResults(options, benchmarkSources(options, solver, geometry));
+    delete solver;
+    return 0;
+  }
+
+  /* Time the eigenvalue calculation with each accelerator */
+  if (options._kernel == "eigenvalue") {
+    writeResults(options, benchmarkEigenvalue(options, solver, geometry));
+    delete solver;
+    return 0;
+  }
+
+  /* Initialize the solver and converge the source for a few iterations */
+  solver->computeEigenvalue(std::max(options._num_warmup, 1));
+
+  /* Open the hardware counters for the solver's threads */
+  PerfCounters counters;
+  if (options._perf)
+    counters.open(options._num_threads);
+
+  /* Time the transport sweeps */
+  std::vector<double> busy_times(options._num_threads);
+  std::vector<double> idle_times(options._num_threads);
+  for (int t=0; t < options._num_threads; t++) {
+    busy_times[t] = -solver->getThreadBusyTime(t);
+    idle_times[t] = -solver->getThreadIdleTime(t);
+  }
+
+  std::vector<double> times = timeSweeps(solver, options._num_sweeps,
+       counters.isAvailable() ? &counters : NULL);
+
+  double busy_time = 0.;
+  double idle_time = 0.;
+  for (int t=0; t < options._num_threads; t++) {
+    busy_times[t] += solver->getThreadBusyTime(t);
+    idle_times[t] += solver->getThreadIdleTime(t);
+    busy_time += busy_times[t];
+    idle_time += idle_times[t];
+  }
+
+  /* Time the transport sweeps with a single thread */
+  std::vector<double> serial_times;
+  if (options._scaling) {
+    solver->setNumThreads(1);
+    solver->initializeExpEvaluator();
+    serial_times = timeSweeps(solver, options._num_sweeps, NULL);
+  }
+
+  /* Compute the sweep metrics */
+  int num_groups = geometry->getNumEnergyGroups();
+  int num_polar_2 = solver->getNumPolarAngles() / 2;
+  long num_segments = track_generator.getNumSegments();
+  double traversals = 2. * num_segments;
+  double sweep_time = median(times);
+  double bytes = bytesPerSegment(options, num_groups, num_polar_2);
+
+  double total_time = 0.;
+  for (size_t i=0; i < times.size(); i++)
+    total_time += times[i];
+
+  /* Write the results as JSON */
+  std::ostringstream json;
+  json.precision(8);
+
+  json << "{\n";
+  json << "  \"benchmark\": \"openmoc-sweep\",\n";
+  json << "  \"version\": {\n";
+  json << "    \"revision\": " << jsonString(OPENMOC_GIT_REVISION) << ",\n";
+  json << "    \"precision\": "
+       << jsonString(sizeof(FP_PRECISION) == sizeof(double) ?
+                     "double" : "single") << ",\n";
+  json << "    \"compiler\": " << jsonString(__VERSION__) << "\n";
+  json << "  },\n";
+
+  json << "  \"configuration\": {\n";
+  json << "    \"geometry\": " << jsonString(options._geometry) << ",\n";
+  json << "    \"num_azim\": " << options._num_azim << ",\n";
+  json << "    \"azim_spacing\": " << options._azim_spacing << ",\n";
+  json << "    \"num_warmup\": " << options._num_warmup << ",\n";
+  json << "    \"num_sweeps\": " << options._num_sweeps << ",\n";
+  json << "    \"num_threads\": " << options._num_threads << ",\n";
+  json << "    \"solver\": " << jsonString(options._solver) << ",\n";
+  json << "    \"accumulation\": " << jsonString(options._accumulation)
+       << ",\n";
+  json << "    \"exponentials\": " << jsonString(options._exponentials)
+       << ",\n";
+  json << "    \"exp_cache\": " << jsonString(options._exp_cache) << ",\n";
+  json << "    \"mixed_precision\": "
+       << (options._mixed_precision ? "true" : "false") << "\n";
+  json << "  },\n";
+
+  json << "  \"problem\": {\n";
+  json << "    \"num_fsrs\": " << geometry->getNumFSRs() << ",\n";
+  json << "    \"num_groups\": " << num_groups << ",\n";
+  json << "    \"num_polar\": " << 2 * num_polar_2 << ",\n";
+  json << "    \"num_tracks\": " << track_generator.getNumTracks() << ",\n";
+  json << "    \"num_segments\": " << num_segments << "\n";
+  json << "  },\n";
+
+  json << "  \"timing\": {\n";
+  json << "    \"sweep_times\": [";
+  for (size_t i=0; i < times.size(); i++)
+    json << (i > 0 ? ", " : "") << times[i];
+  json << "],\n";
+  json << "    \"min_sweep_time\": "
+       << *std::min_element(times.begin(), times.end()) << ",\n";
+  json << "    \"mean_sweep_time\": " << total_time / times.size() << ",\n";
+  json << "    \"median_sweep_time\": " << sweep_time << "\n";
+  json << "  },\n";
+
+  json << "  \"throughput\": {\n";
+  json << "    \"segments_per_second\": " << traversals / sweep_time
+       << ",\n";
+  json << "    \"fsr_group_updates_per_second\": "
+       << traversals * num_groups / sweep_time << ",\n";
+  json << "    \"angular_flux_updates_per_second\": "
+       << traversals * num_groups * num_polar_2 / sweep_time << ",\n";
+  json << "    \"bytes_per_segment\": " << bytes << ",\n";
+  json << "    \"bandwidth_gb_per_second\": "
+       << bytes * traversals / sweep_time / 1.E9 << "\n";
+  json << "  },\n";
+
+  json << "  \"threading\": {\n";
+  json << "    \"busy_time\": " << busy_time << ",\n";
+  json << "    \"idle_time\": " << idle_time << ",\n";
+  json << "    \"load_balance_efficiency\": "
+       << busy_time / std::max(busy_time + idle_time, 1.E-12);
+  if (options._scaling) {
+    double serial_time = median(serial_times);
+    json << ",\n";
+    json << "    \"serial_median_sweep_time\": " << serial_time << ",\n";
+    json << "    \"speedup\": " << serial_time / sweep_time << ",\n";
+    json << "    \"parallel_efficiency\": "
+         << serial_time / sweep_time / options._num_threads;
+  }
+  json << "\n  },\n";
+
+  json << "  \"perf\": {\n";
+  json << "    \"available\": "
+       << (counters.isAvailable() ? "true" : "false");
+  if (counters.isAvailable()) {
+    double num_sweeps = options._num_sweeps;
+    for (int e=0; e < counters.getNumEvents(); e++) {
+      long long count = counters.readEvent(e);
+      json << ",\n    \"" << counters.getEventName(e) << "\": " << count;
+      json << ",\n    \"" << counters.getEventName(e) << "_per_segment\": "
+           << count / (traversals * num_sweeps);
+    }
+
+    /* Events are ordered as cycles, instructions, cache references and
+     * misses, and branch misses */
+    double cycles = counters.readEvent(0);
+    double cache_misses = counters.readEvent(3);
+    json << ",\n    \"instructions_per_cycle\": "
+         << counters.readEvent(1) / std::max(cycles, 1.);
+    json << ",\n    \"memory_bytes_per_segment\": "
+         << 64. * cache_misses / (traversals * num_sweeps);
+  }
+  else if (options._perf)
+    json << ",\n    \"error\": " << jsonString(counters.getError());
+  json << "\n  }\n";
+  json << "}\n";
+
+  writeResults(options, json.str());
+
+  delete solver;
+  return 0;
+}
@@ -0,0 +1,15 @@
+/**
+ * @file geometries.h
+ * @brief Geometries for the transport sweep benchmark.
+ */
+
+
+#ifndef BENCHMARK_GEOMETRIES_H_
+#define BENCHMARK_GEOMETRIES_H_
+
+#include "../../src/Geometry.h"
+
+Geometry* buildC5G7Geometry();
+Geometry* buildSyntheticGeometry(int num_groups, int lattice_width);
+
+#endif /* BENCHMARK_GEOMETRIES_H_ */
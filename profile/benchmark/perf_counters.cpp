@@ -0,0 +1,236 @@
+#include "perf_counters.h"
+#include <omp.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * @struct hardwareEvent
+ * @brief A hardware event counted by the PerfCounters.
+ */
+struct hardwareEvent {
+
+  /** The name of the event in the benchmark output */
+  const char* _name;
+
+  /** The perf_event configuration of the event */
+  unsigned long long _config;
+};
+
+/** The hardware events counted by the PerfCounters */
+static const hardwareEvent hardware_events[] = {
+  {"cycles", PERF_COUNT_HW_CPU_CYCLES},
+  {"instructions", PERF_COUNT_HW_INSTRUCTIONS},
+  {"cache_references", PERF_COUNT_HW_CACHE_REFERENCES},
+  {"cache_misses", PERF_COUNT_HW_CACHE_MISSES},
+  {"branch_misses", PERF_COUNT_HW_BRANCH_MISSES}
+};
+
+static const int num_hardware_events =
+     sizeof(hardware_events) / sizeof(hardware_events[0]);
+#endif
+
+
+/**
+ * @brief Constructor for the PerfCounters which does not open any counters.
+ */
+PerfCounters::PerfCounters() {
+  _num_threads = 0;
+  _available = false;
+  _error = "hardware counters were not requested";
+}
+
+
+/**
+ * @brief Destructor closes any open counters.
+ */
+PerfCounters::~PerfCounters() {
+  close();
+}
+
+
+/**
+ * @brief Opens a counter for each hardware event in each OpenMP thread.
+ * @details The counters are opened from within an OpenMP parallel region so
+ *          that each counter follows the thread which opened it. The
+ *          counters are opened disabled.
+ * @param num_threads the number of OpenMP threads used by the benchmark
+ */
+void PerfCounters::open(int num_threads) {
+
+  close();
+
+#ifdef __linux__
+  _num_threads = num_threads;
+  _fds.assign(num_threads * num_hardware_events, -1);
+  int error = 0;
+
+#pragma omp parallel num_threads(num_threads)
+  {
+    int tid = omp_get_thread_num();
+
+    for (int e=0; e < num_hardware_events; e++) {
+
+      struct perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = hardware_events[e]._config;
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+                         PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      int fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+      _fds[tid*num_hardware_events + e] = fd;
+
+      if (fd < 0) {
+#pragma omp critical
+        error = errno;
+      }
+    }
+  }
+
+  if (error != 0) {
+    close();
+    _error = std::string("unable to open the hardware counters: ") +
+             strerror(error);
+    return;
+  }
+
+  for (int e=0; e < num_hardware_events; e++)
+    _names.push_back(hardware_events[e]._name);
+
+  _available = true;
+  _error = "";
+#else
+  _error = "hardware counters are only supported on Linux";
+#endif
+}
+
+
+/**
+ * @brief Closes all open counters.
+ */
+void PerfCounters::close() {
+
+#ifdef __linux__
+  for (size_t i=0; i < _fds.size(); i++) {
+    if (_fds[i] >= 0)
+      ::close(_fds[i]);
+  }
+#endif
+
+  _fds.clear();
+  _names.clear();
+  _num_threads = 0;
+  _available = false;
+}
+
+
+/**
+ * @brief Resets the counts of all counters to zero.
+ */
+void PerfCounters::reset() {
+#ifdef __linux__
+  for (size_t i=0; i < _fds.size(); i++)
+    ioctl(_fds[i], PERF_EVENT_IOC_RESET, 0);
+#endif
+}
+
+
+/**
+ * @brief Starts counting the hardware events.
+ */
+void PerfCounters::enable() {
+#ifdef __linux__
+  for (size_t i=0; i < _fds.size(); i++)
+    ioctl(_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+#endif
+}
+
+
+/**
+ * @brief Stops counting the hardware events.
+ */
+void PerfCounters::disable() {
+#ifdef __linux__
+  for (size_t i=0; i < _fds.size(); i++)
+    ioctl(_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+#endif
+}
+
+
+/**
+ * @brief Returns whether the hardware counters were opened.
+ * @return true if the counters are available, false otherwise
+ */
+bool PerfCounters::isAvailable() {
+  return _available;
+}
+
+
+/**
+ * @brief Returns the reason the hardware counters are unavailable.
+ * @return a description of the error, or an empty string
+ */
+std::string PerfCounters::getError() {
+  return _error;
+}
+
+
+/**
+ * @brief Returns the number of hardware events which are counted.
+ * @return the number of hardware events
+ */
+int PerfCounters::getNumEvents() {
+  return _names.size();
+}
+
+
+/**
+ * @brief Returns the name of a hardware event.
+ * @param event the index of the hardware event
+ * @return the name of the hardware event
+ */
+std::string PerfCounters::getEventName(int event) {
+  return _names.at(event);
+}
+
+
+/**
+ * @brief Returns the count of a hardware event summed over all threads.
+ * @details If the kernel multiplexed the counters, each thread's count is
+ *          scaled by the fraction of time its counter was running.
+ * @param event the index of the hardware event
+ * @return the count of the hardware event
+ */
+long long PerfCounters::readEvent(int event) {
+
+  long long count = 0;
+
+#ifdef __linux__
+  for (int t=0; t < _num_threads; t++) {
+
+    /* The value, time enabled and time running */
+    unsigned long long values[3];
+    int fd = _fds[t*num_hardware_events + event];
+
+    if (read(fd, values, sizeof(values)) != sizeof(values))
+      continue;
+
+    if (values[2] > 0 && values[2] < values[1])
+      count += (long long)(values[0] * ((double)values[1] / values[2]));
+    else
+      count += values[0];
+  }
+#endif
+
+  return count;
+}
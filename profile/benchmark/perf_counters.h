@@ -0,0 +1,61 @@
+/**
+ * @file perf_counters.h
+ * @brief The PerfCounters class.
+ */
+
+
+#ifndef BENCHMARK_PERF_COUNTERS_H_
+#define BENCHMARK_PERF_COUNTERS_H_
+
+#include <string>
+#include <vector>
+
+
+/**
+ * @class PerfCounters perf_counters.h "profile/benchmark/perf_counters.h"
+ * @brief Reads hardware performance counters with the Linux perf_event
+ *        interface.
+ * @details One counter is opened for each hardware event in each OpenMP
+ *          thread, so the counts include the work of all threads. Only
+ *          user-space events are counted so that no special privileges are
+ *          needed beyond a perf_event_paranoid setting of 2 or less. On other
+ *          platforms, or if the counters cannot be opened, the counters are
+ *          unavailable and the reason is reported by getError().
+ */
+class PerfCounters {
+
+private:
+
+  /** The names of the hardware events */
+  std::vector<std::string> _names;
+
+  /** The perf_event file descriptors for each thread and event */
+  std::vector<int> _fds;
+
+  /** The number of OpenMP threads which opened counters */
+  int _num_threads;
+
+  /** Whether the counters were successfully opened */
+  bool _available;
+
+  /** The reason the counters are unavailable */
+  std::string _error;
+
+public:
+  PerfCounters();
+  virtual ~PerfCounters();
+
+  void open(int num_threads);
+  void close();
+  void reset();
+  void enable();
+  void disable();
+
+  bool isAvailable();
+  std::string getError();
+  int getNumEvents();
+  std::string getEventName(int event);
+  long long readEvent(int event);
+};
+
+#endif /* BENCHMARK_PERF_COUNTERS_H_ */
@@ -65,6 +65,8 @@ class custom_install(install):
     ('debug-mode', None, "Build with debugging symbols"),
     ('profile-mode', None, "Build with profiling symbols"),
     ('with-ccache', None, "Build with ccache for rapid recompilation"),
+    ('simd=', None, "SIMD instruction set (auto, native, avx2, or avx512) " + \
+                    "for the VectorizedSolver with gcc or clang"),
   ]
 
   # Include all of the default options provided by distutils for the
@@ -98,6 +100,7 @@ class custom_install(install):
     # Default compiler and precision level for the main openmoc module
     self.cc = 'gcc'
     self.fp = 'single'
+    self.simd = 'auto'
 
     # Set defaults for each of the newly defined compile time options
     self.with_cuda = False
@@ -143,6 +146,14 @@ class custom_install(install):
     else:
       config.fp = self.fp
 
+    # Check that the user specified a supported SIMD instruction set
+    if self.simd not in ['auto', 'native', 'avx2', 'avx512']:
+      raise DistutilsOptionError \
+          ('Must supply the -simd flag with one of the supported ' +
+           'SIMD instruction sets: auto, native, avx2, avx512')
+    else:
+      config.simd = self.simd
+
     # Build the C/C++/CUDA extension modules for this distribution
     config.setup_extension_modules()
 
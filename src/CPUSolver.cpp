@@ -12,8 +12,47 @@
 CPUSolver::CPUSolver(TrackGenerator* track_generator)
   : Solver(track_generator) {
 
-  setNumThreads(1);
   _FSR_locks = NULL;
+  _flux_accumulation = FSR_LOCKS;
+  _thread_scalar_flux = NULL;
+  _thread_vacuum_flux = NULL;
+  _mixed_precision = false;
+  _accumulated_flux = NULL;
+  _tally_scalar_flux = &CPUSolver::tallyScalarFluxKernel<0, 0>;
+  _cmfd_crossing_lists = true;
+  _exp_cache_requested = false;
+  _exp_cache_precision = EXP_CACHE_FULL;
+  _exp_cache_budget = 1073741824;
+  _exp_cache_size = 0;
+  _exp_cache = NULL;
+  _thread_cached_exponentials = NULL;
+  _thread_busy_times = NULL;
+  _thread_idle_times = NULL;
+  setNumThreads(1);
+}
+
+
+/**
+ * @brief Destructor deletes the thread-private and double precision scalar
+ *        flux arrays and the exponential cache.
+ */
+CPUSolver::~CPUSolver() {
+
+  if (_thread_scalar_flux != NULL)
+    delete [] _thread_scalar_flux;
+
+  if (_thread_vacuum_flux != NULL)
+    delete [] _thread_vacuum_flux;
+
+  clearAccumulatedFluxes();
+
+  if (_thread_busy_times != NULL)
+    delete [] _thread_busy_times;
+
+  if (_thread_idle_times != NULL)
+    delete [] _thread_idle_times;
+
+  clearExpCache();
 }
 
 
@@ -26,6 +65,120 @@ int CPUSolver::getNumThreads() {
 }
 
 
+/**
+ * @brief Returns the algorithm used to accumulate the FSR scalar fluxes.
+ * @return the flux accumulation type (FSR_LOCKS, THREAD_PRIVATE or
+ *         ATOMIC_UPDATES)
+ */
+fluxAccumulationType CPUSolver::getFluxAccumulation() {
+  return _flux_accumulation;
+}
+
+
+/**
+ * @brief Returns whether the exponentials are read from the per-segment
+ *        exponential cache during transport sweeps.
+ * @details The cache is only in use if it was requested with
+ *          useExponentialCache(...) and if it fit within the memory budget
+ *          when it was last initialized.
+ * @return true if the exponential cache is in use
+ */
+bool CPUSolver::isUsingExponentialCache() {
+  return (_exp_cache != NULL);
+}
+
+
+/**
+ * @brief Returns whether the CMFD surface currents are tallied from the
+ *        lists of segments crossing CMFD surfaces.
+ * @return true if the crossing lists are in use (default)
+ */
+bool CPUSolver::isUsingCmfdCrossingLists() {
+  return _cmfd_crossing_lists;
+}
+
+
+/**
+ * @brief Returns whether the FSR scalar fluxes are tallied in double
+ *        precision during each transport sweep.
+ * @return true if mixed precision is in use, false otherwise
+ */
+bool CPUSolver::isUsingMixedPrecision() {
+  return _mixed_precision;
+}
+
+
+/**
+ * @brief Returns the number of bytes used by the exponential cache.
+ * @return the size of the exponential cache (bytes)
+ */
+long CPUSolver::getExponentialCacheSize() {
+  return _exp_cache_size;
+}
+
+
+/**
+ * @brief Returns the time a thread spent sweeping Tracks in all transport
+ *        sweeps of the most recent simulation.
+ * @details Comparing the busy times of all threads measures how evenly the
+ *          Tracks were distributed among the threads.
+ * @param thread the OpenMP thread number
+ * @return the time the thread was busy (seconds)
+ */
+double CPUSolver::getThreadBusyTime(int thread) {
+
+  if (thread < 0 || thread >= _num_threads)
+    log_printf(ERROR, "Unable to get the busy time for thread %d since "
+               "there are only %d threads", thread, _num_threads);
+
+  return _thread_busy_times[thread];
+}
+
+
+/**
+ * @brief Returns the time a thread spent waiting for the other threads to
+ *        finish sweeping Tracks in all transport sweeps of the most recent
+ *        simulation.
+ * @param thread the OpenMP thread number
+ * @return the time the thread was idle (seconds)
+ */
+double CPUSolver::getThreadIdleTime(int thread) {
+
+  if (thread < 0 || thread >= _num_threads)
+    log_printf(ERROR, "Unable to get the idle time for thread %d since "
+               "there are only %d threads", thread, _num_threads);
+
+  return _thread_idle_times[thread];
+}
+
+
+/**
+ * @brief Returns the angular flux array swept along a Track.
+ * @details The incoming angular flux of a Track end with a vacuum boundary
+ *          condition is stored in the shared zero block of the boundary
+ *          fluxes, which may not be modified during the transport sweep.
+ *          Such Tracks are instead swept with the calling thread's angular
+ *          flux buffer, which is set to zero.
+ * @param track_id The Track's unique ID
+ * @param fwd Whether the direction of the angular flux along the track is
+ *        forward (True) or backward (False)
+ * @return a pointer to the Track's angular flux
+ */
+FP_PRECISION* CPUSolver::getBoundaryFlux(int track_id, bool fwd) {
+
+  long offset = _boundary_flux_offsets[2*track_id + !fwd];
+  if (offset != 0)
+    return &_boundary_flux[offset];
+
+  int tid = omp_get_thread_num();
+  FP_PRECISION* track_flux = &_thread_vacuum_flux[tid*_polar_times_groups];
+  for (int i=0; i < _polar_times_groups; i++)
+    track_flux[i] = 0.0;
+
+  return track_flux;
+}
+
+
 /**
  * @brief Fills an array with the scalar fluxes.
  * @details This class method is a helper routine called by the OpenMOC
@@ -81,6 +234,188 @@ void CPUSolver::setNumThreads(int num_threads) {
   /* Set the number of threads for OpenMP */
   _num_threads = num_threads;
   omp_set_num_threads(_num_threads);
+
+  /* Thread-private fluxes must be resized for the new number of threads */
+  if (_thread_scalar_flux != NULL) {
+    delete [] _thread_scalar_flux;
+    _thread_scalar_flux = NULL;
+  }
+
+  /* The double precision tallies must be resized for the new threads */
+  clearAccumulatedFluxes();
+
+  /* The exponential cache is rebuilt with buffers for the new threads */
+  clearExpCache();
+
+  /* Allocate the busy and idle times for each thread */
+  if (_thread_busy_times != NULL)
+    delete [] _thread_busy_times;
+
+  if (_thread_idle_times != NULL)
+    delete [] _thread_idle_times;
+
+  _thread_busy_times = new double[_num_threads];
+  _thread_idle_times = new double[_num_threads];
+  clearTimerSplits();
+}
+
+
+/**
+ * @brief Sets the algorithm used to accumulate the FSR scalar fluxes
+ *        during each transport sweep.
+ * @details Each Track segment contributes to the scalar flux of the FSR it
+ *          crosses, and Tracks are swept concurrently by many threads. This
+ *          method selects how these concurrent updates are made safe:
+ *
+ *          - FSR_LOCKS (default): an OpenMP lock is acquired for each FSR
+ *          - THREAD_PRIVATE: each thread tallies into its own copy of the
+ *            scalar flux array, which is reduced at the end of the sweep
+ *            at the cost of one extra flux array per thread
+ *          - ATOMIC_UPDATES: each group's flux is incremented atomically
+ *
+ *          This routine may be called from Python as follows:
+ *
+ * @code
+ *          solver.setFluxAccumulation(openmoc.THREAD_PRIVATE)
+ * @endcode
+ *
+ * @param accumulation the flux accumulation type
+ */
+void CPUSolver::setFluxAccumulation(fluxAccumulationType accumulation) {
+
+  if (accumulation != FSR_LOCKS && accumulation != THREAD_PRIVATE &&
+      accumulation != ATOMIC_UPDATES)
+    log_printf(ERROR, "Unable to set the flux accumulation type to %d "
+               "since it is not a valid fluxAccumulationType", accumulation);
+
+  _flux_accumulation = accumulation;
+
+  /* Free the thread-private fluxes if they are no longer needed */
+  if (_flux_accumulation != THREAD_PRIVATE && _thread_scalar_flux != NULL) {
+    delete [] _thread_scalar_flux;
+    _thread_scalar_flux = NULL;
+  }
+
+  /* The number of double precision tallies depends on the accumulation */
+  clearAccumulatedFluxes();
+}
+
+
+/**
+ * @brief Informs the Solver to precompute the exponentials for each Track
+ *        segment, polar angle and energy group once per simulation.
+ * @details The exponentials in the transport equation only depend on the
+ *          segment lengths and the total cross-sections, so they may be
+ *          computed once when the simulation is initialized and read from
+ *          memory in each transport sweep. The exponentials may be stored
+ *          in a reduced precision to lower the memory footprint:
+ *
+ *          - EXP_CACHE_FULL (default): stored with FP_PRECISION
+ *          - EXP_CACHE_SINGLE: stored in single precision
+ *          - EXP_CACHE_FIXED16: stored as 16-bit fixed point numbers with
+ *            an absolute error of less than 1E-5
+ *
+ *          The cache is not used if it would require more memory than the
+ *          budget set with setExponentialCacheBudget(...). This routine may
+ *          be called from Python as follows:
+ *
+ * @code
+ *          solver.useExponentialCache(openmoc.EXP_CACHE_SINGLE)
+ * @endcode
+ *
+ * @param precision the representation of the cached exponentials
+ */
+void CPUSolver::useExponentialCache(expCachePrecision precision) {
+
+  if (precision != EXP_CACHE_FULL && precision != EXP_CACHE_SINGLE &&
+      precision != EXP_CACHE_FIXED16)
+    log_printf(ERROR, "Unable to use the exponential cache with precision %d "
+               "since it is not a valid expCachePrecision", precision);
+
+  _exp_cache_requested = true;
+  _exp_cache_precision = precision;
+}
+
+
+/**
+ * @brief Informs the Solver to evaluate the exponentials for each segment
+ *        in each transport sweep (default).
+ */
+void CPUSolver::disableExponentialCache() {
+  _exp_cache_requested = false;
+  clearExpCache();
+}
+
+
+/**
+ * @brief Sets the maximum amount of memory the exponential cache may use.
+ * @details The default budget is 1 GiB.
+ * @param budget the maximum size of the exponential cache (bytes)
+ */
+void CPUSolver::setExponentialCacheBudget(long budget) {
+
+  if (budget < 0)
+    log_printf(ERROR, "Unable to set the exponential cache budget to %ld "
+               "bytes since it is negative", budget);
+
+  _exp_cache_budget = budget;
+}
+
+
+/**
+ * @brief Sets whether the CMFD surface currents are tallied from the lists
+ *        of segments crossing CMFD surfaces.
+ * @details By default, the transport sweep integrates the runs of segments
+ *          between CMFD surface crossings without testing each segment for
+ *          a crossing, and tallies the current at the end of each run from
+ *          the TrackGenerator's lists of crossing segments. Otherwise, each
+ *          segment's CMFD surfaces are tested as it is swept.
+ * @param crossing_lists whether to use the crossing lists (true) or not
+ */
+void CPUSolver::setCmfdCrossingLists(bool crossing_lists) {
+  _cmfd_crossing_lists = crossing_lists;
+}
+
+
+/**
+ * @brief Informs the Solver to tally the FSR scalar fluxes in double
+ *        precision in each transport sweep.
+ * @details When OpenMOC is compiled in single precision, the contributions
+ *          of many segments to the scalar flux of an FSR may lose precision
+ *          when they are summed in single precision. In mixed precision, the
+ *          segment lengths, exponentials and angular fluxes remain in single
+ *          precision, while the scalar flux of each FSR and energy group is
+ *          tallied in double precision and only rounded to FP_PRECISION at
+ *          the end of each transport sweep. This requires 8 bytes of memory
+ *          per FSR and energy group, or per thread, FSR and energy group with
+ *          the THREAD_PRIVATE flux accumulation type. Mixed precision is not
+ *          needed when OpenMOC is compiled in double precision.
+ *
+ *          This routine may be called from Python as follows:
+ *
+ * @code
+ *          solver.useMixedPrecision()
+ * @endcode
+ */
+void CPUSolver::useMixedPrecision() {
+
+  if (sizeof(FP_PRECISION) == sizeof(double)) {
+    log_printf(WARNING, "Unable to use mixed precision since the scalar "
+               "fluxes are already tallied in double precision");
+    return;
+  }
+
+  _mixed_precision = true;
+}
+
+
+/**
+ * @brief Informs the Solver to tally the FSR scalar fluxes with
+ *        FP_PRECISION (default).
+ */
+void CPUSolver::disableMixedPrecision() {
+  _mixed_precision = false;
+  clearAccumulatedFluxes();
 }
 
 
@@ -117,14 +452,28 @@ void CPUSolver::setFluxes(FP_PRECISION* in_fluxes, int num_fluxes) {
 }
 
 
+/**
+ * @brief Initializes the exponential evaluator and the exponential cache.
+ * @details The exponential cache is built after the Track segments have
+ *          been split for the exponential evaluator such that it holds one
+ *          entry per segment in the transport sweep.
+ */
+void CPUSolver::initializeExpEvaluator() {
+  Solver::initializeExpEvaluator();
+  initializeExpCache();
+}
+
+
 /**
  * @brief Initializes the FSR volumes and Materials array.
  * @details This method gets an array of OpenMP mutual exclusion locks
- *          for each FSR for use in the transport sweep algorithm.
+ *          for each FSR for use in the transport sweep algorithm and selects
+ *          the sweep kernel for the number of energy groups and polar angles.
  */
 void CPUSolver::initializeFSRs() {
   Solver::initializeFSRs();
   _FSR_locks = _track_generator->getFSRLocks();
+  initializeSweepKernel();
 }
 
 
@@ -142,18 +491,31 @@ void CPUSolver::initializeFluxArrays() {
   if (_start_flux != NULL)
     delete [] _start_flux;
 
+  if (_thread_vacuum_flux != NULL)
+    delete [] _thread_vacuum_flux;
+
   if (_scalar_flux != NULL)
     delete [] _scalar_flux;
 
   if (_old_scalar_flux != NULL)
     delete [] _old_scalar_flux;
 
+  /* Only Track ends with reflective or periodic boundaries store fluxes */
+  initializeBoundaryFluxOffsets();
+
   /* Allocate memory for the Track boundary flux arrays */
   try {
-    int size = 2 * _tot_num_tracks * _polar_times_groups;
+    long size = _num_boundary_fluxes * _polar_times_groups;
     _boundary_flux = new FP_PRECISION[size];
     _start_flux = new FP_PRECISION[size];
 
+    log_printf(INFO, "Boundary fluxes require %f MB of memory",
+               2 * size * sizeof(FP_PRECISION) / 1.E6);
+
+    /* Allocate the angular flux buffers for vacuum Track ends */
+    size = _num_threads * _polar_times_groups;
+    _thread_vacuum_flux = new FP_PRECISION[size];
+
     /* Allocate an array for the FSR scalar flux */
     size = _num_FSRs * _num_groups;
     _scalar_flux = new FP_PRECISION[size];
@@ -162,6 +524,166 @@ void CPUSolver::initializeFluxArrays() {
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the fluxes");
   }
+
+  initializeFluxAccumulation();
+}
+
+
+/**
+ * @brief Prepares the algorithm used to accumulate the FSR scalar fluxes.
+ * @details This method allocates the thread-private scalar fluxes if they
+ *          are needed and reports which accumulation algorithm is in use.
+ */
+void CPUSolver::initializeFluxAccumulation() {
+
+  /* Allocate the thread-private or double precision fluxes if needed */
+  if (_mixed_precision)
+    initializeAccumulatedFluxes();
+  else if (_flux_accumulation == THREAD_PRIVATE)
+    initializeThreadScalarFluxes();
+
+  if (_flux_accumulation == FSR_LOCKS)
+    log_printf(NORMAL, "Accumulating FSR scalar fluxes with OpenMP locks");
+  else if (_flux_accumulation == THREAD_PRIVATE)
+    log_printf(NORMAL, "Accumulating FSR scalar fluxes with %d thread-private "
+               "arrays", _num_threads);
+  else
+    log_printf(NORMAL, "Accumulating FSR scalar fluxes with atomic updates");
+
+  if (_mixed_precision)
+    log_printf(NORMAL, "Tallying FSR scalar fluxes in double precision");
+}
+
+
+/**
+ * @brief Allocates memory for the thread-private FSR scalar fluxes.
+ * @details One copy of the scalar flux array is allocated for each OpenMP
+ *          thread for use with the THREAD_PRIVATE flux accumulation type.
+ */
+void CPUSolver::initializeThreadScalarFluxes() {
+
+  if (_thread_scalar_flux != NULL)
+    delete [] _thread_scalar_flux;
+
+  long size = (long)_num_threads * _num_FSRs * _num_groups;
+
+  try {
+    _thread_scalar_flux = new FP_PRECISION[size];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the thread-private "
+               "fluxes");
+  }
+
+  log_printf(INFO, "Thread-private fluxes require %f MB of memory",
+             size * sizeof(FP_PRECISION) / 1.E6);
+}
+
+
+/**
+ * @brief Zeros the thread-private scalar flux for each thread, FSR and
+ *        energy group.
+ */
+void CPUSolver::zeroThreadScalarFluxes() {
+
+#pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int t=0; t < _num_threads; t++) {
+      for (int e=0; e < _num_groups; e++)
+        _thread_scalar_flux(t,r,e) = 0.0;
+    }
+  }
+}
+
+
+/**
+ * @brief Sums the thread-private scalar fluxes into the FSR scalar fluxes.
+ */
+void CPUSolver::reduceThreadScalarFluxes() {
+
+#pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int t=0; t < _num_threads; t++) {
+      for (int e=0; e < _num_groups; e++)
+        _scalar_flux(r,e) += _thread_scalar_flux(t,r,e);
+    }
+  }
+}
+
+
+/**
+ * @brief Allocates memory for the double precision FSR scalar flux tallies.
+ * @details One copy of the tallies is allocated for each OpenMP thread with
+ *          the THREAD_PRIVATE flux accumulation type, and a single shared
+ *          copy is allocated otherwise.
+ */
+void CPUSolver::initializeAccumulatedFluxes() {
+
+  clearAccumulatedFluxes();
+
+  int num_copies = (_flux_accumulation == THREAD_PRIVATE) ? _num_threads : 1;
+  long size = (long)num_copies * _num_FSRs * _num_groups;
+
+  try {
+    _accumulated_flux = new double[size];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the double precision "
+               "fluxes");
+  }
+
+  log_printf(INFO, "Double precision fluxes require %f MB of memory",
+             size * sizeof(double) / 1.E6);
+}
+
+
+/**
+ * @brief Deletes the double precision FSR scalar flux tallies.
+ */
+void CPUSolver::clearAccumulatedFluxes() {
+
+  if (_accumulated_flux != NULL)
+    delete [] _accumulated_flux;
+
+  _accumulated_flux = NULL;
+}
+
+
+/**
+ * @brief Zeros the double precision scalar flux tallies for each FSR and
+ *        energy group.
+ */
+void CPUSolver::zeroAccumulatedFluxes() {
+
+  int num_copies = (_flux_accumulation == THREAD_PRIVATE) ? _num_threads : 1;
+
+#pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int t=0; t < num_copies; t++) {
+      for (int e=0; e < _num_groups; e++)
+        _accumulated_flux(t,r,e) = 0.0;
+    }
+  }
+}
+
+
+/**
+ * @brief Sums the double precision scalar flux tallies and rounds them into
+ *        the FSR scalar fluxes.
+ */
+void CPUSolver::reduceAccumulatedFluxes() {
+
+  int num_copies = (_flux_accumulation == THREAD_PRIVATE) ? _num_threads : 1;
+
+#pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int e=0; e < _num_groups; e++) {
+      double flux = 0.0;
+      for (int t=0; t < num_copies; t++)
+        flux += _accumulated_flux(t,r,e);
+      _scalar_flux(r,e) = flux;
+    }
+  }
 }
 
 
@@ -236,16 +758,12 @@ void CPUSolver::initializeFixedSources() {
  */
 void CPUSolver::zeroTrackFluxes() {
 
+  long size = _num_boundary_fluxes * _polar_times_groups;
+
 #pragma omp parallel for schedule(guided)
-  for (int t=0; t < _tot_num_tracks; t++) {
-    for (int d=0; d < 2; d++) {
-      for (int p=0; p < _num_polar_2; p++) {
-        for (int e=0; e < _num_groups; e++) {
-          _boundary_flux(t,d,p,e) = 0.0;
-          _start_flux(t,d,p,e) = 0.0;
-        }
-      }
-    }
+  for (long i=0; i < size; i++) {
+    _boundary_flux[i] = 0.0;
+    _start_flux[i] = 0.0;
   }
 }
 
@@ -256,16 +774,11 @@ void CPUSolver::zeroTrackFluxes() {
  */
 void CPUSolver::copyBoundaryFluxes() {
 
-  #pragma omp parallel for schedule(guided)
-  for (int t=0; t < _tot_num_tracks; t++) {
-    for (int d=0; d < 2; d++) {
-      for (int p=0; p < _num_polar_2; p++) {
-        for (int e=0; e < _num_groups; e++) {
-          _boundary_flux(t, d, p, e) = _start_flux(t, d, p, e);
-        }
-      }
-    }
-  }
+  long size = _num_boundary_fluxes * _polar_times_groups;
+
+#pragma omp parallel for schedule(guided)
+  for (long i=0; i < size; i++)
+    _boundary_flux[i] = _start_flux[i];
 }
 
 
@@ -299,23 +812,24 @@ void CPUSolver::storeFSRFluxes() {
 /**
  * @brief Normalizes all FSR scalar fluxes and Track boundary angular
  *        fluxes to the total fission source (times \f$ \nu \f$).
+ * @details The total fission source is summed in double precision.
  */
 void CPUSolver::normalizeFluxes() {
 
   FP_PRECISION* nu_sigma_f;
   FP_PRECISION volume;
-  FP_PRECISION tot_fission_source;
+  double tot_fission_source;
   FP_PRECISION norm_factor;
 
   int size = _num_FSRs * _num_groups;
-  FP_PRECISION* fission_sources = new FP_PRECISION[_num_FSRs * _num_groups];
+  double* fission_sources = new double[_num_FSRs * _num_groups];
 
   /* Compute total fission source for each FSR, energy group */
 #pragma omp parallel for private(volume, nu_sigma_f) schedule(guided)
   for (int r=0; r < _num_FSRs; r++) {
 
     /* Get pointers to important data structures */
-    nu_sigma_f = _FSR_materials[r]->getNuSigmaF();
+    nu_sigma_f = _FSR_nu_sigma_f(r);
     volume = _FSR_volumes[r];
 
     for (int e=0; e < _num_groups; e++)
@@ -323,7 +837,7 @@ void CPUSolver::normalizeFluxes() {
   }
 
   /* Compute the total fission source */
-  tot_fission_source = pairwise_sum<FP_PRECISION>(fission_sources,size);
+  tot_fission_source = pairwise_sum<double>(fission_sources, size);
 
   /* Deallocate memory for fission source array */
   delete [] fission_sources;
@@ -343,16 +857,12 @@ void CPUSolver::normalizeFluxes() {
   }
 
   /* Normalize angular boundary fluxes for each Track */
+  long num_boundary_fluxes = _num_boundary_fluxes * _polar_times_groups;
+
 #pragma omp parallel for schedule(guided)
-  for (int t=0; t < _tot_num_tracks; t++) {
-    for (int d=0; d < 2; d++) {
-      for (int p=0; p < _num_polar_2; p++) {
-        for (int e=0; e < _num_groups; e++) {
-          _boundary_flux(t,d,p,e) *= norm_factor;
-          _start_flux(t,d,p,e) *= norm_factor;
-        }
-      }
-    }
+  for (long i=0; i < num_boundary_fluxes; i++) {
+    _boundary_flux[i] *= norm_factor;
+    _start_flux[i] *= norm_factor;
   }
 }
 
@@ -366,10 +876,11 @@ void CPUSolver::computeFSRSources() {
 
 #pragma omp parallel default(none)
   {
-    int tid;
-    Material* material;
     FP_PRECISION* sigma_t;
-    FP_PRECISION sigma_s, fiss_mat;
+    FP_PRECISION* sigma_s;
+    FP_PRECISION* fiss_mat;
+    int* scatter_bands;
+    bool fissionable;
     FP_PRECISION scatter_source, fission_source;
     FP_PRECISION* fission_sources = new FP_PRECISION[_num_groups];
     FP_PRECISION* scatter_sources = new FP_PRECISION[_num_groups];
@@ -378,24 +889,37 @@ void CPUSolver::computeFSRSources() {
 #pragma omp for schedule(guided)
     for (int r=0; r < _num_FSRs; r++) {
 
-      tid = omp_get_thread_num();
-      material = _FSR_materials[r];
-      sigma_t = material->getSigmaT();
+      sigma_t = _FSR_sigma_t(r);
+      scatter_bands = _FSR_scatter_bands(r);
+      fissionable = _FSR_materials[r]->isFissionable();
 
       /* Compute scatter + fission source for group g */
       for (int g=0; g < _num_groups; g++) {
-        for (int g_prime=0; g_prime < _num_groups; g_prime++) {
-          sigma_s = material->getSigmaSByGroup(g_prime+1,g+1);
-          fiss_mat = material->getFissionMatrixByGroup(g_prime+1,g+1);
-          scatter_sources[g_prime] = sigma_s * _scalar_flux(r,g_prime);
-          fission_sources[g_prime] = fiss_mat * _scalar_flux(r,g_prime);
-        }
+
+        /* Sum the scattering source over the groups which scatter into g */
+        int start = scatter_bands[2*g];
+        int end = scatter_bands[2*g+1];
+        sigma_s = _FSR_sigma_s(r) + g*_num_groups;
+
+        for (int g_prime=start; g_prime < end; g_prime++)
+          scatter_sources[g_prime-start] = sigma_s[g_prime] *
+                                           _scalar_flux(r,g_prime);
 
         scatter_source = pairwise_sum<FP_PRECISION>(scatter_sources,
-                                                    _num_groups);
-        fission_source = pairwise_sum<FP_PRECISION>(fission_sources,
-                                                    _num_groups);
-        fission_source /= _k_eff;
+                                                    end - start);
+
+        fission_source = 0.;
+        if (fissionable) {
+          fiss_mat = _FSR_fiss_matrix(r) + g*_num_groups;
+
+          for (int g_prime=0; g_prime < _num_groups; g_prime++)
+            fission_sources[g_prime] = fiss_mat[g_prime] *
+                                       _scalar_flux(r,g_prime);
+
+          fission_source = pairwise_sum<FP_PRECISION>(fission_sources,
+                                                      _num_groups);
+          fission_source /= _k_eff;
+        }
 
         /* Compute total (scatter+fission+fixed) reduced source */
         _reduced_sources(r,g) = _fixed_sources(r,g);
@@ -417,10 +941,8 @@ void CPUSolver::computeFSRFissionSources() {
 
 #pragma omp parallel default(none)
   {
-    int tid;
-    Material* material;
     FP_PRECISION* sigma_t;
-    FP_PRECISION fiss_mat;
+    FP_PRECISION* fiss_mat;
     FP_PRECISION fission_source;
     FP_PRECISION* fission_sources = new FP_PRECISION[_num_groups];
 
@@ -428,16 +950,15 @@ void CPUSolver::computeFSRFissionSources() {
 #pragma omp for schedule(guided)
     for (int r=0; r < _num_FSRs; r++) {
 
-      tid = omp_get_thread_num();
-      material = _FSR_materials[r];
-      sigma_t = material->getSigmaT();
+      sigma_t = _FSR_sigma_t(r);
 
       /* Compute scatter + fission source for group g */
       for (int g=0; g < _num_groups; g++) {
-        for (int g_prime=0; g_prime < _num_groups; g_prime++) {
-          fiss_mat = material->getFissionMatrixByGroup(g_prime+1,g+1);
-          fission_sources[g_prime] = fiss_mat * _scalar_flux(r,g_prime);
-        }
+        fiss_mat = _FSR_fiss_matrix(r) + g*_num_groups;
+
+        for (int g_prime=0; g_prime < _num_groups; g_prime++)
+          fission_sources[g_prime] = fiss_mat[g_prime] *
+                                     _scalar_flux(r,g_prime);
 
         fission_source = pairwise_sum<FP_PRECISION>(fission_sources,
                                                     _num_groups);
@@ -460,10 +981,9 @@ void CPUSolver::computeFSRScatterSources() {
 
 #pragma omp parallel default(none)
   {
-    int tid;
-    Material* material;
     FP_PRECISION* sigma_t;
-    FP_PRECISION sigma_s;
+    FP_PRECISION* sigma_s;
+    int* scatter_bands;
     FP_PRECISION scatter_source;
     FP_PRECISION* scatter_sources = new FP_PRECISION[_num_groups];
 
@@ -471,19 +991,23 @@ void CPUSolver::computeFSRScatterSources() {
 #pragma omp for schedule(guided)
     for (int r=0; r < _num_FSRs; r++) {
 
-      tid = omp_get_thread_num();
-      material = _FSR_materials[r];
-      sigma_t = material->getSigmaT();
+      sigma_t = _FSR_sigma_t(r);
+      scatter_bands = _FSR_scatter_bands(r);
 
       /* Compute scatter + fission source for group g */
       for (int g=0; g < _num_groups; g++) {
-        for (int g_prime=0; g_prime < _num_groups; g_prime++) {
-          sigma_s = material->getSigmaSByGroup(g_prime+1,g+1);
-          scatter_sources[g_prime] = sigma_s * _scalar_flux(r,g_prime);
-        }
+
+        /* Sum the scattering source over the groups which scatter into g */
+        int start = scatter_bands[2*g];
+        int end = scatter_bands[2*g+1];
+        sigma_s = _FSR_sigma_s(r) + g*_num_groups;
+
+        for (int g_prime=start; g_prime < end; g_prime++)
+          scatter_sources[g_prime-start] = sigma_s[g_prime] *
+                                           _scalar_flux(r,g_prime);
 
         scatter_source = pairwise_sum<FP_PRECISION>(scatter_sources,
-                                                    _num_groups);
+                                                    end - start);
 
         /* Compute total (scatter) reduced source */
         _reduced_sources(r,g) = scatter_source;
@@ -535,16 +1059,14 @@ double CPUSolver::computeResidual(residualType res_type) {
 
       double new_fission_source, old_fission_source;
       FP_PRECISION* nu_sigma_f;
-      Material* material;
 
 #pragma omp for schedule(guided)
       for (int r=0; r < _num_FSRs; r++) {
         new_fission_source = 0.;
         old_fission_source = 0.;
-        material = _FSR_materials[r];
 
-        if (material->isFissionable()) {
-          nu_sigma_f = material->getNuSigmaF();
+        if (_FSR_materials[r]->isFissionable()) {
+          nu_sigma_f = _FSR_nu_sigma_f(r);
 
           for (int e=0; e < _num_groups; e++) {
             new_fission_source += _scalar_flux(r,e) * nu_sigma_f[e];
@@ -569,18 +1091,18 @@ double CPUSolver::computeResidual(residualType res_type) {
       double new_total_source, old_total_source;
       FP_PRECISION inverse_k_eff = 1.0 / _k_eff;
       FP_PRECISION* nu_sigma_f;
-      Material* material;
       FP_PRECISION* sigma_s;
+      int* scatter_bands;
 
 #pragma omp for schedule(guided)
       for (int r=0; r < _num_FSRs; r++) {
         new_total_source = 0.;
         old_total_source = 0.;
-        material = _FSR_materials[r];
-        sigma_s = material->getSigmaS();
+        sigma_s = _FSR_sigma_s(r);
+        scatter_bands = _FSR_scatter_bands(r);
 
-        if (material->isFissionable()) {
-          nu_sigma_f = material->getNuSigmaF();
+        if (_FSR_materials[r]->isFissionable()) {
+          nu_sigma_f = _FSR_nu_sigma_f(r);
 
           for (int e=0; e < _num_groups; e++) {
             new_total_source += _scalar_flux(r,e) * nu_sigma_f[e];
@@ -593,7 +1115,7 @@ double CPUSolver::computeResidual(residualType res_type) {
 
         /* Compute total scattering source for group G */
         for (int G=0; G < _num_groups; G++) {
-          for (int g=0; g < _num_groups; g++) {
+          for (int g=scatter_bands[2*G]; g < scatter_bands[2*G+1]; g++) {
             new_total_source += sigma_s[G*_num_groups+g]
                 * _scalar_flux(r,g);
             old_total_source += sigma_s[G*_num_groups+g]
@@ -621,11 +1143,12 @@ double CPUSolver::computeResidual(residualType res_type) {
 
 /**
  * @brief Compute \f$ k_{eff} \f$ from successive fission sources.
+ * @details The fission rates are reduced across FSRs in double precision.
  */
 void CPUSolver::computeKeff() {
 
-  FP_PRECISION fission;
-  FP_PRECISION* FSR_rates = new FP_PRECISION[_num_FSRs];
+  double fission;
+  double* FSR_rates = new double[_num_FSRs];
   FP_PRECISION* group_rates = new FP_PRECISION[_num_threads * _num_groups];
 
   /* Compute the old nu-fission rates in each FSR */
@@ -633,7 +1156,6 @@ void CPUSolver::computeKeff() {
   {
 
     int tid = omp_get_thread_num() * _num_groups;
-    Material* material;
     FP_PRECISION* sigma;
     FP_PRECISION volume;
 
@@ -641,8 +1163,7 @@ void CPUSolver::computeKeff() {
     for (int r=0; r < _num_FSRs; r++) {
 
       volume = _FSR_volumes[r];
-      material = _FSR_materials[r];
-      sigma = material->getNuSigmaF();
+      sigma = _FSR_nu_sigma_f(r);
 
       for (int e=0; e < _num_groups; e++)
         group_rates[tid+e] = sigma[e] * _scalar_flux(r,e);
@@ -653,7 +1174,7 @@ void CPUSolver::computeKeff() {
   }
 
   /* Reduce new fission rates across FSRs */
-  fission = pairwise_sum<FP_PRECISION>(FSR_rates, _num_FSRs);
+  fission = pairwise_sum<double>(FSR_rates, _num_FSRs);
 
   _k_eff *= fission;
 
@@ -676,8 +1197,24 @@ void CPUSolver::transportSweep() {
   if (_cmfd != NULL && _cmfd->isFluxUpdateOn())
     _cmfd->zeroCurrents();
 
+  /* Initialize the double precision fluxes to zero */
+  if (_mixed_precision) {
+    if (_accumulated_flux == NULL)
+      initializeAccumulatedFluxes();
+    zeroAccumulatedFluxes();
+  }
+
   /* Initialize flux in each FSR to zero */
-  flattenFSRFluxes(0.0);
+  else {
+    flattenFSRFluxes(0.0);
+
+    /* Initialize the thread-private fluxes to zero */
+    if (_flux_accumulation == THREAD_PRIVATE) {
+      if (_thread_scalar_flux == NULL)
+        initializeThreadScalarFluxes();
+      zeroThreadScalarFluxes();
+    }
+  }
 
   /* Copy starting flux to current flux */
   copyBoundaryFluxes();
@@ -687,6 +1224,23 @@ void CPUSolver::transportSweep() {
   TransportSweep sweep_tracks(_track_generator);
   sweep_tracks.setCPUSolver(this);
   sweep_tracks.execute();
+
+  /* Accumulate the time each thread spent sweeping and waiting */
+  for (int t=0; t < _num_threads; t++) {
+    _thread_busy_times[t] += sweep_tracks.getThreadBusyTime(t);
+    _thread_idle_times[t] += sweep_tracks.getThreadIdleTime(t);
+  }
+
+  /* Sum the surface currents tallied by each thread */
+  if (_cmfd != NULL && _cmfd->isFluxUpdateOn())
+    _cmfd->reduceCurrents();
+
+  /* Reduce the thread-private or double precision fluxes into the FSR
+     scalar fluxes */
+  if (_mixed_precision)
+    reduceAccumulatedFluxes();
+  else if (_flux_accumulation == THREAD_PRIVATE)
+    reduceThreadScalarFluxes();
 }
 
 
@@ -694,59 +1248,360 @@ void CPUSolver::transportSweep() {
  * @brief Computes the contribution to the FSR scalar flux from a Track segment.
  * @details This method integrates the angular flux for a Track segment across
  *          energy groups and polar angles, and tallies it into the FSR
- *          scalar flux, and updates the Track's angular flux.
- * @param curr_segment a pointer to the Track segment of interest
+ *          scalar flux, and updates the Track's angular flux. The work is
+ *          delegated to the sweep kernel selected by initializeSweepKernel().
+ * @param segment_id the index of the segment in the flattened segments
+ * @param length the length of the Track segment (cm)
+ * @param material a pointer to the Material in which the segment resides
+ * @param fsr_id the ID of the FSR in which the segment resides
  * @param azim_index a pointer to the azimuthal angle index for this segment
  * @param track_flux a pointer to the Track's angular flux
  * @param fsr_flux a pointer to the temporary FSR flux buffer
- * @param fwd
  */
-void CPUSolver::tallyScalarFlux(segment* curr_segment, int azim_index,
-                                FP_PRECISION* track_flux,
+void CPUSolver::tallyScalarFlux(long segment_id, FP_PRECISION length,
+                                Material* material, int fsr_id,
+                                int azim_index, FP_PRECISION* track_flux,
                                 FP_PRECISION* fsr_flux) {
+  (this->*_tally_scalar_flux)(segment_id, length, material, fsr_id,
+                              azim_index, track_flux, fsr_flux);
+}
+
+
+/**
+ * @brief Sweep kernel which computes the contribution to the FSR scalar flux
+ *        from a Track segment.
+ * @details The kernel is templated on the number of energy groups and the
+ *          number of polar angles in each hemisphere. If these are known at
+ *          compile time, the compiler may fully unroll and vectorize the
+ *          group and polar angle loops. A template parameter of zero
+ *          indicates that the corresponding count is only known at runtime.
+ *          The exponentials are read from the exponential cache if it is
+ *          in use and are otherwise computed by the ExpEvaluator.
+ * @param segment_id the index of the segment in the flattened segments
+ * @param length the length of the Track segment (cm)
+ * @param material a pointer to the Material in which the segment resides
+ * @param fsr_id the ID of the FSR in which the segment resides
+ * @param azim_index a pointer to the azimuthal angle index for this segment
+ * @param track_flux a pointer to the Track's angular flux
+ * @param fsr_flux a pointer to the temporary FSR flux buffer
+ */
+template <int NUM_GROUPS, int NUM_POLAR_2>
+void CPUSolver::tallyScalarFluxKernel(long segment_id, FP_PRECISION length,
+                                      Material* material, int fsr_id,
+                                      int azim_index, FP_PRECISION* track_flux,
+                                      FP_PRECISION* fsr_flux) {
+
+  const int num_groups = (NUM_GROUPS > 0) ? NUM_GROUPS : _num_groups;
+  const int num_polar_2 = (NUM_POLAR_2 > 0) ? NUM_POLAR_2 : _num_polar_2;
 
-  int fsr_id = curr_segment->_region_id;
-  FP_PRECISION length = curr_segment->_length;
-  FP_PRECISION* sigma_t = curr_segment->_material->getSigmaT();
+  FP_PRECISION* sigma_t = material->getSigmaT();
+  FP_PRECISION* reduced_sources = &_reduced_sources[fsr_id*num_groups];
   FP_PRECISION delta_psi, exponential;
 
+  /* Get this segment's exponentials if they have been cached */
+  FP_PRECISION* exponentials = NULL;
+  if (_exp_cache != NULL)
+    exponentials = getCachedExponentials(segment_id);
+
   /* Set the FSR scalar flux buffer to zero */
-  memset(fsr_flux, 0.0, _num_groups * sizeof(FP_PRECISION));
+  for (int e=0; e < num_groups; e++)
+    fsr_flux[e] = 0.0;
 
   /* Compute change in angular flux along segment in this FSR */
-  for (int e=0; e < _num_groups; e++) {
-    for (int p=0; p < _num_polar_2; p++) {
-      exponential = _exp_evaluator->computeExponential(sigma_t[e] * length, p);
-      delta_psi = (track_flux(p,e)-_reduced_sources(fsr_id,e)) * exponential;
+  for (int e=0; e < num_groups; e++) {
+    for (int p=0; p < num_polar_2; p++) {
+      if (exponentials != NULL)
+        exponential = exponentials[p*num_groups+e];
+      else
+        exponential = _exp_evaluator->computeExponential(sigma_t[e] * length,
+                                                         p);
+      delta_psi = (track_flux[p*num_groups+e] - reduced_sources[e]) *
+                  exponential;
       fsr_flux[e] += delta_psi * _quadrature->getWeightInline(azim_index, p);
-      track_flux(p,e) -= delta_psi;
+      track_flux[p*num_groups+e] -= delta_psi;
     }
   }
 
-  /* Atomically increment the FSR scalar flux from the temporary array */
-  omp_set_lock(&_FSR_locks[fsr_id]);
-  {
+  accumulateScalarFlux(fsr_id, fsr_flux);
+}
+
+
+/**
+ * @brief Increments an FSR's scalar flux by a segment's contribution.
+ * @details The FSR scalar flux is incremented using the algorithm selected
+ *          with setFluxAccumulation(...), in double precision if mixed
+ *          precision is in use.
+ * @param fsr_id the ID of the FSR of interest
+ * @param fsr_flux a pointer to the segment's contribution in each group
+ */
+void CPUSolver::accumulateScalarFlux(int fsr_id,
+                                     FP_PRECISION* fsr_flux) {
+
+  /* Increment the double precision FSR scalar flux tallies */
+  if (_mixed_precision) {
+    if (_flux_accumulation == FSR_LOCKS) {
+      omp_set_lock(&_FSR_locks[fsr_id]);
+      {
+        for (int e=0; e < _num_groups; e++)
+          _accumulated_flux(0,fsr_id,e) += fsr_flux[e];
+      }
+      omp_unset_lock(&_FSR_locks[fsr_id]);
+    }
+    else if (_flux_accumulation == THREAD_PRIVATE) {
+      int tid = omp_get_thread_num();
+      for (int e=0; e < _num_groups; e++)
+        _accumulated_flux(tid,fsr_id,e) += fsr_flux[e];
+    }
+    else {
+      for (int e=0; e < _num_groups; e++) {
+#pragma omp atomic update
+        _accumulated_flux(0,fsr_id,e) += fsr_flux[e];
+      }
+    }
+  }
+
+  /* Increment the FSR scalar flux from the temporary array */
+  else if (_flux_accumulation == FSR_LOCKS) {
+    omp_set_lock(&_FSR_locks[fsr_id]);
+    {
+      for (int e=0; e < _num_groups; e++)
+        _scalar_flux(fsr_id,e) += fsr_flux[e];
+    }
+    omp_unset_lock(&_FSR_locks[fsr_id]);
+  }
+  else if (_flux_accumulation == THREAD_PRIVATE) {
+    int tid = omp_get_thread_num();
     for (int e=0; e < _num_groups; e++)
+      _thread_scalar_flux(tid,fsr_id,e) += fsr_flux[e];
+  }
+  else {
+    for (int e=0; e < _num_groups; e++) {
+#pragma omp atomic update
       _scalar_flux(fsr_id,e) += fsr_flux[e];
+    }
+  }
+}
+
+
+/**
+ * @brief Computes and stores the exponentials for each Track segment, polar
+ *        angle and energy group if the exponential cache was requested.
+ * @details The exponentials are stored for each segment in the order of the
+ *          flattened segment arrays, with the energy groups varying fastest
+ *          for each polar angle. The cache is not built if it would exceed
+ *          the memory budget, in which case the exponentials are evaluated
+ *          in each transport sweep.
+ */
+void CPUSolver::initializeExpCache() {
+
+  clearExpCache();
+
+  if (!_exp_cache_requested)
+    return;
+
+  segment_arrays* segments = _track_generator->getSegmentArrays();
+  long num_segments = segments->_num_segments;
+
+  /* Single precision storage is the full precision in single builds */
+  expCachePrecision precision = _exp_cache_precision;
+  if (precision == EXP_CACHE_SINGLE && sizeof(FP_PRECISION) == sizeof(float))
+    precision = EXP_CACHE_FULL;
+
+  int entry_size;
+  if (precision == EXP_CACHE_FULL)
+    entry_size = sizeof(FP_PRECISION);
+  else if (precision == EXP_CACHE_SINGLE)
+    entry_size = sizeof(float);
+  else
+    entry_size = sizeof(uint16_t);
+
+  long num_entries = num_segments * _polar_times_groups;
+  long size = num_entries * entry_size;
+
+  /* Refuse to build the cache if it would exceed the memory budget */
+  if (size > _exp_cache_budget) {
+    log_printf(WARNING, "Unable to use the exponential cache since it "
+               "requires %f MB of memory which exceeds the budget of %f MB",
+               size / 1.E6, _exp_cache_budget / 1.E6);
+    return;
+  }
+
+  try {
+    _exp_cache = new char[size];
+    _thread_cached_exponentials =
+         new FP_PRECISION[_num_threads * _polar_times_groups];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the exponential cache");
+  }
+
+  _exp_cache_size = size;
+  _exp_cache_precision = precision;
+
+  log_printf(NORMAL, "Caching exponentials for %ld segments requires %f MB "
+             "of memory", num_segments, size / 1.E6);
+
+  FP_PRECISION* lengths = segments->_lengths;
+  int* material_indices = segments->_material_indices;
+  Material** materials = segments->_materials;
+
+  /* Compute the exponentials for each segment */
+#pragma omp parallel for schedule(guided)
+  for (long s=0; s < num_segments; s++) {
+
+    FP_PRECISION* sigma_t = materials[material_indices[s]]->getSigmaT();
+    FP_PRECISION exponential;
+    long index;
+
+    for (int p=0; p < _num_polar_2; p++) {
+      for (int e=0; e < _num_groups; e++) {
+        exponential = _exp_evaluator->computeExponential(sigma_t[e] *
+                                                         lengths[s], p);
+        index = s * _polar_times_groups + p * _num_groups + e;
+
+        if (precision == EXP_CACHE_FULL)
+          ((FP_PRECISION*)_exp_cache)[index] = exponential;
+        else if (precision == EXP_CACHE_SINGLE)
+          ((float*)_exp_cache)[index] = exponential;
+        else {
+          exponential = std::min(std::max(exponential, FP_PRECISION(0.)),
+                                 FP_PRECISION(1.));
+          ((uint16_t*)_exp_cache)[index] = uint16_t(exponential * 65535. +
+                                                    0.5);
+        }
+      }
+    }
+  }
+}
+
+
+/**
+ * @brief Deletes the exponential cache if it was allocated.
+ */
+void CPUSolver::clearExpCache() {
+
+  if (_exp_cache != NULL) {
+    delete [] _exp_cache;
+    _exp_cache = NULL;
+  }
+
+  if (_thread_cached_exponentials != NULL) {
+    delete [] _thread_cached_exponentials;
+    _thread_cached_exponentials = NULL;
+  }
+
+  _exp_cache_size = 0;
+}
+
+
+/**
+ * @brief Returns the cached exponentials for a Track segment.
+ * @details Exponentials stored with FP_PRECISION are returned in place.
+ *          Otherwise, they are decoded into a buffer for the calling thread.
+ * @param segment_id the index of the segment in the flattened segments
+ * @return a pointer to the exponentials indexed by polar angle and group
+ */
+FP_PRECISION* CPUSolver::getCachedExponentials(long segment_id) {
+
+  long offset = segment_id * _polar_times_groups;
+
+  if (_exp_cache_precision == EXP_CACHE_FULL)
+    return &((FP_PRECISION*)_exp_cache)[offset];
+
+  FP_PRECISION* exponentials =
+       &_thread_cached_exponentials[omp_get_thread_num() * _polar_times_groups];
+
+  if (_exp_cache_precision == EXP_CACHE_SINGLE) {
+    float* cache = &((float*)_exp_cache)[offset];
+    for (int i=0; i < _polar_times_groups; i++)
+      exponentials[i] = cache[i];
+  }
+  else {
+    uint16_t* cache = &((uint16_t*)_exp_cache)[offset];
+    for (int i=0; i < _polar_times_groups; i++)
+      exponentials[i] = cache[i] * FP_PRECISION(1. / 65535.);
+  }
+
+  return exponentials;
+}
+
+
+/**
+ * @brief Selects the sweep kernel for a given number of polar angles based
+ *        upon the number of energy groups.
+ * @return whether a specialized kernel was found (true) or not (false)
+ */
+template <int NUM_POLAR_2>
+bool CPUSolver::selectSweepKernel() {
+
+  switch (_num_groups) {
+  case 1:
+    _tally_scalar_flux = &CPUSolver::tallyScalarFluxKernel<1, NUM_POLAR_2>;
+    return true;
+  case 2:
+    _tally_scalar_flux = &CPUSolver::tallyScalarFluxKernel<2, NUM_POLAR_2>;
+    return true;
+  case 7:
+    _tally_scalar_flux = &CPUSolver::tallyScalarFluxKernel<7, NUM_POLAR_2>;
+    return true;
+  case 70:
+    _tally_scalar_flux = &CPUSolver::tallyScalarFluxKernel<70, NUM_POLAR_2>;
+    return true;
+  default:
+    _tally_scalar_flux = &CPUSolver::tallyScalarFluxKernel<0, 0>;
+    return false;
+  }
+}
+
+
+/**
+ * @brief Selects the sweep kernel for the number of energy groups and
+ *        polar angles in the simulation.
+ * @details Kernels are specialized at compile time for 1, 2, 7 and 70
+ *          energy groups with 1, 2 or 3 polar angles per hemisphere. Any
+ *          other combination uses the generic kernel.
+ */
+void CPUSolver::initializeSweepKernel() {
+
+  bool specialized;
+
+  switch (_num_polar_2) {
+  case 1:
+    specialized = selectSweepKernel<1>();
+    break;
+  case 2:
+    specialized = selectSweepKernel<2>();
+    break;
+  case 3:
+    specialized = selectSweepKernel<3>();
+    break;
+  default:
+    _tally_scalar_flux = &CPUSolver::tallyScalarFluxKernel<0, 0>;
+    specialized = false;
   }
-  omp_unset_lock(&_FSR_locks[fsr_id]);
+
+  if (specialized)
+    log_printf(INFO, "Using the sweep kernel specialized for %d groups and "
+               "%d polar angles", _num_groups, 2*_num_polar_2);
+  else
+    log_printf(INFO, "Using the generic sweep kernel for %d groups and "
+               "%d polar angles", _num_groups, 2*_num_polar_2);
 }
 
 
 /**
  * @brief Tallies the current contribution from this segment across the
  *        the appropriate CMFD mesh cell surface.
- * @param curr_segment a pointer to the Track segment of interest
+ * @param cmfd_surface the ID of the CMFD mesh surface crossed
  * @param azim_index the azimuthal index for this segmenbt
  * @param track_flux a pointer to the Track's angular flux
- * @param fwd boolean indicating direction of integration along segment
  */
-void CPUSolver::tallyCurrent(segment* curr_segment, int azim_index,
-                             FP_PRECISION* track_flux, bool fwd) {
+void CPUSolver::tallyCurrent(int cmfd_surface, int azim_index,
+                             FP_PRECISION* track_flux) {
 
   /* Tally surface currents if CMFD is in use */
   if (_cmfd != NULL && _cmfd->isFluxUpdateOn())
-    _cmfd->tallyCurrent(curr_segment, track_flux, azim_index, fwd);
+    _cmfd->tallyCurrent(cmfd_surface, track_flux, azim_index);
 }
 
 
@@ -755,7 +1610,8 @@ void CPUSolver::tallyCurrent(segment* curr_segment, int azim_index,
  * @details For reflective and periodic boundary conditions, the outgoing
  *          boundary flux for the Track is given to the corresponding reflecting
  *          or periodic Track. For vacuum boundary conditions, the outgoing flux
- *          is tallied as leakage.
+ *          is tallied as leakage and the receiving Track end keeps its zero
+ *          incoming flux.
  * @param track_id the ID number for the Track of interest
  * @param azim_index a pointer to the azimuthal angle index for this segment
  * @param direction the Track direction (forward - true, reverse - false)
@@ -765,30 +1621,34 @@ void CPUSolver::transferBoundaryFlux(int track_id,
                                      int azim_index,
                                      bool direction,
                                      FP_PRECISION* track_flux) {
-  int start;
+  int next;
   bool transfer_flux;
   int track_out_id;
 
   /* For the "forward" direction */
   if (direction) {
-    start = _tracks[track_id]->isNextOut() * _polar_times_groups;
+    next = _tracks[track_id]->isNextOut();
     transfer_flux = _tracks[track_id]->getTransferFluxOut();
     track_out_id = _tracks[track_id]->getTrackOut()->getUid();
   }
 
   /* For the "reverse" direction */
   else {
-    start = _tracks[track_id]->isNextIn() * _polar_times_groups;
+    next = _tracks[track_id]->isNextIn();
     transfer_flux = _tracks[track_id]->getTransferFluxIn();
     track_out_id = _tracks[track_id]->getTrackIn()->getUid();
   }
 
-  FP_PRECISION* track_out_flux = &_start_flux(track_out_id, 0, 0, start);
+  /* The flux leaks out of vacuum boundaries */
+  if (!transfer_flux)
+    return;
+
+  FP_PRECISION* track_out_flux = &_start_flux(track_out_id, next, 0, 0);
 
   /* Loop over polar angles and energy groups */
   for (int e=0; e < _num_groups; e++) {
     for (int p=0; p < _num_polar_2; p++)
-      track_out_flux(p,e) = track_flux(p,e) * transfer_flux;
+      track_out_flux(p,e) = track_flux(p,e);
   }
 }
 
@@ -807,7 +1667,7 @@ void CPUSolver::addSourceToScalarFlux() {
 #pragma omp parallel for private(volume, sigma_t) schedule(guided)
   for (int r=0; r < _num_FSRs; r++) {
     volume = _FSR_volumes[r];
-    sigma_t = _FSR_materials[r]->getSigmaT();
+    sigma_t = _FSR_sigma_t(r);
 
     for (int e=0; e < _num_groups; e++) {
       _scalar_flux(r,e) /= (sigma_t[e] * volume);
@@ -858,3 +1718,50 @@ void CPUSolver::computeFSRFissionRates(double* fission_rates, int num_FSRs) {
       fission_rates[r] += sigma_f[e] * _scalar_flux(r,e) * volume;
   }
 }
+
+
+/**
+ * @brief Deletes the Timer's timing entries and zeros the busy and idle
+ *        times of each thread.
+ */
+void CPUSolver::clearTimerSplits() {
+
+  Solver::clearTimerSplits();
+
+  for (int t=0; t < _num_threads; t++) {
+    _thread_busy_times[t] = 0.;
+    _thread_idle_times[t] = 0.;
+  }
+}
+
+
+/**
+ * @brief Prints a report of the timing statistics to the console.
+ * @details In addition to the Solver's timing statistics, the time each
+ *          thread spent sweeping Tracks and waiting for the other threads
+ *          is reported.
+ */
+void CPUSolver::printTimerReport() {
+
+  Solver::printTimerReport();
+
+  std::string msg_string;
+
+  for (int t=0; t < _num_threads; t++) {
+    std::stringstream busy_msg, idle_msg;
+
+    busy_msg << "Thread " << t << " time sweeping Tracks";
+    msg_string = busy_msg.str();
+    msg_string.resize(REPORT_WIDTH, '.');
+    log_printf(RESULT, "%s%1.4E sec", msg_string.c_str(),
+               _thread_busy_times[t]);
+
+    idle_msg << "Thread " << t << " time waiting for other threads";
+    msg_string = idle_msg.str();
+    msg_string.resize(REPORT_WIDTH, '.');
+    log_printf(RESULT, "%s%1.4E sec", msg_string.c_str(),
+               _thread_idle_times[t]);
+  }
+
+  log_printf(SEPARATOR, "-");
+}
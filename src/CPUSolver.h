@@ -16,6 +16,7 @@
 #include <math.h>
 #include <omp.h>
 #include <stdlib.h>
+#include <stdint.h>
 #endif
 
 
@@ -29,6 +30,55 @@
  *  group for the outgoing reflective track from a given Track */
 #define track_out_flux(p,e) (track_out_flux[(p)*_num_groups + (e)])
 
+/** Indexing macro for the thread-private scalar flux in each FSR and energy
+ *  group for a given OpenMP thread */
+#define _thread_scalar_flux(t,r,e) (_thread_scalar_flux[((long)(t)*_num_FSRs \
+                                                        + (r))*_num_groups \
+                                                        + (e)])
+
+/** Indexing macro for the double precision scalar flux tallies in each FSR
+ *  and energy group for a given copy of the tallies */
+#define _accumulated_flux(t,r,e) (_accumulated_flux[((long)(t)*_num_FSRs \
+                                                    + (r))*_num_groups \
+                                                    + (e)])
+
+
+/**
+ * @enum fluxAccumulationType
+ * @brief The algorithm used to accumulate each segment's contribution to the
+ *        FSR scalar fluxes during a transport sweep.
+ */
+enum fluxAccumulationType {
+
+  /** An OpenMP mutual exclusion lock guards each FSR (default) */
+  FSR_LOCKS,
+
+  /** Each thread tallies into a private copy of the scalar flux array which
+   *  is reduced across threads at the end of the transport sweep */
+  THREAD_PRIVATE,
+
+  /** Each FSR scalar flux is incremented with an OpenMP atomic update */
+  ATOMIC_UPDATES
+};
+
+
+/**
+ * @enum expCachePrecision
+ * @brief The floating point representation of the exponentials stored in
+ *        the per-segment exponential cache.
+ */
+enum expCachePrecision {
+
+  /** Exponentials are stored with FP_PRECISION (default) */
+  EXP_CACHE_FULL,
+
+  /** Exponentials are stored in single precision */
+  EXP_CACHE_SINGLE,
+
+  /** Exponentials are stored as 16-bit fixed point numbers in [0, 1] */
+  EXP_CACHE_FIXED16
+};
+
 
 /**
  * @class CPUSolver CPUSolver.h "src/CPUSolver.h"
@@ -45,28 +95,111 @@ protected:
   /** OpenMP mutual exclusion locks for atomic FSR scalar flux updates */
   omp_lock_t* _FSR_locks;
 
+  /** The algorithm used to accumulate the FSR scalar fluxes */
+  fluxAccumulationType _flux_accumulation;
+
+  /** Thread-private scalar fluxes for each FSR and energy group */
+  FP_PRECISION* _thread_scalar_flux;
+
+  /** Angular flux buffers for each thread to sweep Track ends with vacuum
+   *  boundary conditions, which share a zero block in the boundary fluxes */
+  FP_PRECISION* _thread_vacuum_flux;
+
+  /** Whether the FSR scalar fluxes are tallied in double precision */
+  bool _mixed_precision;
+
+  /** Double precision scalar flux tallies for each FSR and energy group,
+   *  with one copy per thread for the THREAD_PRIVATE accumulation type */
+  double* _accumulated_flux;
+
+  /** A pointer to the sweep kernel used to tally segment contributions
+   *  to the FSR scalar fluxes, specialized for the number of energy groups
+   *  and polar angles if possible */
+  void (CPUSolver::*_tally_scalar_flux)(long, FP_PRECISION, Material*, int,
+                                        int, FP_PRECISION*, FP_PRECISION*);
+
+  /** Whether the CMFD surface currents are tallied from the lists of
+   *  segments crossing CMFD surfaces (true) or by testing each segment */
+  bool _cmfd_crossing_lists;
+
+  /** Whether the user requested the per-segment exponential cache */
+  bool _exp_cache_requested;
+
+  /** The representation of the exponentials in the exponential cache */
+  expCachePrecision _exp_cache_precision;
+
+  /** The maximum number of bytes the exponential cache may use */
+  long _exp_cache_budget;
+
+  /** The number of bytes used by the exponential cache */
+  long _exp_cache_size;
+
+  /** The exponentials for each segment, polar angle and energy group, or
+   *  NULL if the exponential cache is not in use */
+  char* _exp_cache;
+
+  /** Buffers for each thread's exponentials decoded from the cache */
+  FP_PRECISION* _thread_cached_exponentials;
+
+  /** The time each thread spent sweeping Tracks (seconds) */
+  double* _thread_busy_times;
+
+  /** The time each thread spent waiting for other threads to finish
+   *  sweeping Tracks (seconds) */
+  double* _thread_idle_times;
+
+  void clearTimerSplits();
+
+  void initializeFluxAccumulation();
+  void initializeThreadScalarFluxes();
+  void zeroThreadScalarFluxes();
+  void reduceThreadScalarFluxes();
+  void initializeAccumulatedFluxes();
+  void clearAccumulatedFluxes();
+  void zeroAccumulatedFluxes();
+  void reduceAccumulatedFluxes();
+  void initializeSweepKernel();
+
+  template <int NUM_POLAR_2>
+  bool selectSweepKernel();
+
+  template <int NUM_GROUPS, int NUM_POLAR_2>
+  void tallyScalarFluxKernel(long segment_id, FP_PRECISION length,
+                             Material* material, int fsr_id, int azim_index,
+                             FP_PRECISION* track_flux, FP_PRECISION* fsr_flux);
+
+  void accumulateScalarFlux(int fsr_id, FP_PRECISION* fsr_flux);
+
+  void initializeExpCache();
+  void clearExpCache();
+  FP_PRECISION* getCachedExponentials(long segment_id);
+
 public:
   CPUSolver(TrackGenerator* track_generator=NULL);
+  virtual ~CPUSolver();
 
   /**
    * @brief Computes the contribution to the FSR flux from a Track segment.
-   * @param curr_segment a pointer to the Track segment of interest
+   * @param segment_id the index of the segment in the flattened segments
+   * @param length the length of the Track segment (cm)
+   * @param material a pointer to the Material in which the segment resides
+   * @param fsr_id the ID of the FSR in which the segment resides
    * @param azim_index a pointer to the azimuthal angle index for this segment
    * @param track_flux a pointer to the Track's angular flux
    * @param fsr_flux a pointer to the temporary FSR scalar flux buffer
    */
-  virtual void tallyScalarFlux(segment* curr_segment, int azim_index,
+  virtual void tallyScalarFlux(long segment_id, FP_PRECISION length,
+                               Material* material, int fsr_id, int azim_index,
                                FP_PRECISION* track_flux, FP_PRECISION* fsr_flux);
 
   /**
    * @brief Computes the contribution to surface current from a segment.
-   * @param curr_segment a pointer to the Track segment of interest
+   * @param cmfd_surface the ID of the CMFD mesh surface crossed
    * @param azim_index a pointer to the azimuthal angle index for this segment
    * @param track_flux a pointer to the Track's angular flux
-   * @param fwd the direction of integration along the segment
    */
-  virtual void tallyCurrent(segment* curr_segment, int azim_index,
-                            FP_PRECISION* track_flux, bool fwd);
+  virtual void tallyCurrent(int cmfd_surface, int azim_index,
+                            FP_PRECISION* track_flux);
 
   /**
    * @brief Updates the boundary flux for a Track given boundary conditions.
@@ -79,11 +212,27 @@ public:
                                     bool direction, FP_PRECISION* track_flux);
 
   int getNumThreads();
+  fluxAccumulationType getFluxAccumulation();
+  bool isUsingExponentialCache();
+  long getExponentialCacheSize();
+  double getThreadBusyTime(int thread);
+  double getThreadIdleTime(int thread);
+  bool isUsingCmfdCrossingLists();
+  bool isUsingMixedPrecision();
+  FP_PRECISION* getBoundaryFlux(int track_id, bool fwd);
   virtual void getFluxes(FP_PRECISION* out_fluxes, int num_fluxes);
 
   void setNumThreads(int num_threads);
+  void setFluxAccumulation(fluxAccumulationType accumulation);
+  void useExponentialCache(expCachePrecision precision=EXP_CACHE_FULL);
+  void disableExponentialCache();
+  void setExponentialCacheBudget(long budget);
+  void setCmfdCrossingLists(bool crossing_lists);
+  void useMixedPrecision();
+  void disableMixedPrecision();
   virtual void setFluxes(FP_PRECISION* in_fluxes, int num_fluxes);
 
+  void initializeExpEvaluator();
   void initializeFluxArrays();
   void initializeSourceArrays();
   void initializeFixedSources();
@@ -103,6 +252,8 @@ public:
   double computeResidual(residualType res_type);
 
   void computeFSRFissionRates(double* fission_rates, int num_FSRs);
+
+  void printTimerReport();
 };
 
 
@@ -888,6 +888,26 @@ bool Cell::containsCoords(LocalCoords* coords) {
 }
 
 
+/**
+ * @brief Determines whether a LocalCoords is inside a Cell and not on any
+ *        of the Cell's Surfaces.
+ * @details A LocalCoords which is strictly inside a Cell is not contained
+ *          by any other Cell which does not overlap it. A Cell without a
+ *          bounding Region strictly contains everything if it is filled by
+ *          a Material and is conservatively taken to contain nothing
+ *          strictly if it is filled by a Universe.
+ * @param coords a pointer to a localcoord
+ * @returns true if the LocalCoords is strictly inside the Cell
+ */
+bool Cell::containsCoordsStrictly(LocalCoords* coords) {
+
+  if (_region == NULL)
+    return _cell_type == MATERIAL;
+  else
+    return _region->containsPointStrictly(coords->getPoint());
+}
+
+
 /**
  * @brief Computes the minimum distance to a Surface in the Cell's Region from
  *        a point with a given trajectory at a certain angle stored in a
@@ -169,6 +169,7 @@ public:
   bool isFissionable();
   bool containsPoint(Point* point);
   bool containsCoords(LocalCoords* coords);
+  bool containsCoordsStrictly(LocalCoords* coords);
   double minSurfaceDist(LocalCoords* coords);
 
   Cell* clone();
@@ -46,6 +46,9 @@ Cmfd::Cmfd() {
   _group_indices_map = NULL;
   _user_group_indices = false;
   _surface_currents = NULL;
+  _num_threads = 0;
+  _thread_currents_stride = 0;
+  _thread_currents = NULL;
   _cell_locks = NULL;
   _volumes = NULL;
   _lattice = NULL;
@@ -101,6 +104,9 @@ Cmfd::~Cmfd() {
   if (_surface_currents != NULL)
     delete _surface_currents;
 
+  if (_thread_currents != NULL)
+    delete [] _thread_currents;
+
   if (_volumes != NULL)
     delete _volumes;
 
@@ -925,6 +931,12 @@ void Cmfd::initializeCurrents() {
   _surface_currents = new Vector(_cell_locks, _num_x, _num_y,
                                  _num_cmfd_groups * NUM_SURFACES);
 
+  /* The thread surface currents are reallocated by zeroCurrents() */
+  if (_thread_currents != NULL)
+    delete [] _thread_currents;
+  _thread_currents = NULL;
+  _num_threads = 0;
+
   return;
 }
 
@@ -1049,6 +1061,8 @@ Lattice* Cmfd::getLattice() {
  */
 void Cmfd::addFSRToCell(int cell_id, int fsr_id) {
   _cell_fsrs.at(cell_id).push_back(fsr_id);
+  _FSR_cells.clear();
+  _track_end_cells.clear();
 }
 
 
@@ -1351,17 +1365,39 @@ int Cmfd::getBoundary(int side) {
  */
 int Cmfd::convertFSRIdToCmfdCell(int fsr_id) {
 
-  std::vector<int>::iterator iter;
-  for (int cell_id=0; cell_id < _num_x * _num_y; cell_id++) {
+  if (_FSR_cells.empty())
+    initializeFSRCells();
 
-    for (iter = _cell_fsrs.at(cell_id).begin();
-         iter != _cell_fsrs.at(cell_id).end(); ++iter) {
-      if (*iter  == fsr_id)
-        return cell_id;
-    }
+  if (fsr_id < 0 || fsr_id >= (int)_FSR_cells.size())
+    return -1;
+
+  return _FSR_cells[fsr_id];
+}
+
+
+/**
+ * @brief Builds the map from each FSR ID to the CMFD cell containing it.
+ * @details The map inverts the FSR IDs contained in each CMFD cell so that
+ *          convertFSRIdToCmfdCell(...) does not need to search every cell.
+ *          FSRs which are not in any CMFD cell are mapped to -1. The map is
+ *          rebuilt when the FSRs in the CMFD cells change.
+ */
+void Cmfd::initializeFSRCells() {
+
+  int num_FSRs = 0;
+  for (size_t cell_id=0; cell_id < _cell_fsrs.size(); cell_id++) {
+    std::vector<int>& fsrs = _cell_fsrs[cell_id];
+    for (size_t i=0; i < fsrs.size(); i++)
+      num_FSRs = std::max(num_FSRs, fsrs[i] + 1);
   }
 
-  return -1;
+  /* Assign each FSR to the first CMFD cell containing it */
+  _FSR_cells.assign(num_FSRs, -1);
+  for (int cell_id=(int)_cell_fsrs.size()-1; cell_id >= 0; cell_id--) {
+    std::vector<int>& fsrs = _cell_fsrs[cell_id];
+    for (size_t i=0; i < fsrs.size(); i++)
+      _FSR_cells[fsrs[i]] = cell_id;
+  }
 }
 
 
@@ -1390,6 +1426,8 @@ void Cmfd::setCellFSRs(std::vector< std::vector<int> >* cell_fsrs) {
   }
 
   _cell_fsrs = *cell_fsrs;
+  _FSR_cells.clear();
+  _track_end_cells.clear();
 }
 
 
@@ -1764,63 +1802,104 @@ FP_PRECISION Cmfd::getDistanceToCentroid(Point* centroid, int cell_id,
 }
 
 
+/**
+ * @brief Finds the CMFD cell at each end of each Track for the boundary
+ *        flux update.
+ * @details The incoming angular flux at the start of a Track is rescaled by
+ *          the flux ratio of the CMFD cell containing the Track's first
+ *          segment, and the incoming flux at the end of the Track by that of
+ *          the cell containing its last segment. Track ends with vacuum
+ *          boundary conditions are not rescaled and are assigned -1. The
+ *          cells are found once after the Tracks have been segmented and
+ *          reused by each call to updateBoundaryFlux(...).
+ * @param tracks 2D array of Tracks
+ * @param segments the segments of all Tracks
+ * @param num_tracks The number of Tracks
+ */
+void Cmfd::initializeTrackEndCells(Track** tracks, segment_arrays* segments,
+                                   int num_tracks) {
+
+  /* Build the FSR to CMFD cell map serially before the parallel loop */
+  if (_FSR_cells.empty())
+    initializeFSRCells();
+
+  _track_end_cells.resize(2 * (size_t)num_tracks);
+
+#pragma omp parallel for schedule(guided)
+  for (int i=0; i < num_tracks; i++) {
+
+    int uid = tracks[i]->getUid();
+    long first_segment = segments->_track_offsets[uid];
+    long last_segment = segments->_track_offsets[uid+1] - 1;
+    int start_cell = -1;
+    int end_cell = -1;
+
+    if (tracks[i]->getBCIn() != VACUUM)
+      start_cell = convertFSRIdToCmfdCell(segments->_region_ids[first_segment]);
+    if (tracks[i]->getBCOut() != VACUUM)
+      end_cell = convertFSRIdToCmfdCell(segments->_region_ids[last_segment]);
+
+    _track_end_cells[2*i] = start_cell;
+    _track_end_cells[2*i+1] = end_cell;
+  }
+}
+
+
 /**
  * @brief Update the MOC boundary fluxes.
  * @details The MOC boundary fluxes are updated using the P0 approximation.
  *          With this approximation, the boundary fluxes are updated using
  *          the ratio of new to old flux for the cell that the outgoing flux
- *          from the track enters.
+ *          from the track enters. The CMFD cell at each Track end is found
+ *          on the first update after the Tracks or the CMFD mesh change, and
+ *          the flux ratios are expanded to the MOC energy groups so that
+ *          each Track end is rescaled with a contiguous loop over polar
+ *          angles and groups.
  * @param tracks 2D array of Tracks
+ * @param segments the segments of all Tracks
  * @param boundary_flux Array of boundary fluxes
- * @return The number of Tracks
+ * @param boundary_flux_offsets The offset of each Track's forward and
+ *        reverse boundary fluxes in the boundary flux array
+ * @param num_tracks The number of Tracks
  */
-void Cmfd::updateBoundaryFlux(Track** tracks, FP_PRECISION* boundary_flux,
-                              int num_tracks) {
-
-  segment* segments;
-  segment* curr_segment;
-  int num_segments;
-  int bc;
-  FP_PRECISION* track_flux;
-  FP_PRECISION ratio;
-  int cell_id;
+void Cmfd::updateBoundaryFlux(Track** tracks, segment_arrays* segments,
+                              FP_PRECISION* boundary_flux,
+                              long* boundary_flux_offsets, int num_tracks) {
 
   log_printf(DEBUG, "Updating boundary flux...");
 
-  /* Loop over Tracks */
-  for (int i=0; i < num_tracks; i++) {
+  if (_track_end_cells.size() != 2 * (size_t)num_tracks)
+    initializeTrackEndCells(tracks, segments, num_tracks);
 
-    num_segments = tracks[i]->getNumSegments();
-    segments = tracks[i]->getSegments();
+  /* Expand the CMFD flux ratios to the MOC energy groups */
+  int num_cells = getNumCells();
+  _boundary_flux_ratios.resize((size_t)num_cells * _num_moc_groups);
+  FP_PRECISION* cmfd_ratios = _flux_ratio->getArray();
+  FP_PRECISION* ratios = &_boundary_flux_ratios[0];
+
+#pragma omp parallel for schedule(static)
+  for (int i=0; i < num_cells; i++) {
+    for (int e=0; e < _num_moc_groups; e++)
+      ratios[i*_num_moc_groups + e] =
+        cmfd_ratios[i*_num_cmfd_groups + getCmfdGroup(e)];
+  }
 
-    /* Update boundary flux in forward direction */
-    bc = (int)tracks[i]->getBCIn();
-    curr_segment = &segments[0];
-    track_flux = &boundary_flux[i*2*_num_moc_groups*_num_polar_2];
-    cell_id = convertFSRIdToCmfdCell(curr_segment->_region_id);
+  /* Rescale the incoming flux at each end of each Track. Each end which is
+   * not vacuum owns its block of the boundary flux array. */
+#pragma omp parallel for schedule(guided)
+  for (long i=0; i < 2 * (long)num_tracks; i++) {
 
-    if (bc) {
-      for (int e=0; e < _num_moc_groups; e++) {
-        for (int p=0; p < _num_polar_2; p++) {
-          track_flux[p*_num_moc_groups + e] *= _flux_ratio->getValue
-            (cell_id, e);
-        }
-      }
-    }
+    int cell_id = _track_end_cells[i];
+    if (cell_id < 0)
+      continue;
 
-    /* Update boundary flux in backwards direction */
-    bc = (int)tracks[i]->getBCOut();
-    curr_segment = &segments[num_segments - 1];
-    track_flux = &boundary_flux[(i*2 + 1)*_num_moc_groups*_num_polar_2];
-    cell_id = convertFSRIdToCmfdCell(curr_segment->_region_id);
-
-    if (bc) {
-      for (int e=0; e < _num_moc_groups; e++) {
-        for (int p=0; p < _num_polar_2; p++) {
-          track_flux[p*_num_moc_groups + e] *= _flux_ratio->getValue
-            (cell_id, e);
-        }
-      }
+    FP_PRECISION* track_flux = &boundary_flux[boundary_flux_offsets[i]];
+    FP_PRECISION* cell_ratios = &ratios[cell_id * _num_moc_groups];
+
+    for (int p=0; p < _num_polar_2; p++) {
+#pragma omp simd
+      for (int e=0; e < _num_moc_groups; e++)
+        track_flux(p,e) *= cell_ratios[e];
     }
   }
 }
@@ -1851,66 +1930,105 @@ void Cmfd::setKNearest(int k_nearest) {
 /**
  * @brief Zero the surface currents for each mesh cell and energy
  *        group.
+ * @details Each thread tallies surface currents into its own copy of the
+ *          currents during a transport sweep, which are allocated here for
+ *          the maximum number of OpenMP threads if needed. This requires
+ *          memory for the currents of every CMFD cell surface and group for
+ *          each thread. The copies are summed into the surface currents by
+ *          reduceCurrents() after the transport sweep.
  */
 void Cmfd::zeroCurrents() {
+
   _surface_currents->clear();
-}
 
+  int num_threads = omp_get_max_threads();
+  long num_currents = (long)getNumCells() * NUM_SURFACES * _num_cmfd_groups;
 
-/**
- * @brief Tallies the current contribution from this segment across the
- *        the appropriate CMFD mesh cell surface.
- * @param curr_segment The current Track segment
- * @param track_flux The outgoing angular flux for this segment
- * @param azim_index Azimuthal angle index of the current Track
- * @param fwd Boolean indicating direction of integration along segment
- */
-void Cmfd::tallyCurrent(segment* curr_segment, FP_PRECISION* track_flux,
-                        int azim_index, bool fwd) {
+  if (_thread_currents == NULL || _num_threads != num_threads) {
 
-  int surf_id, cell_id;
-  int ncg = _num_cmfd_groups;
-  FP_PRECISION currents[_num_cmfd_groups];
-  memset(currents, 0.0, sizeof(FP_PRECISION) * _num_cmfd_groups);
+    if (_thread_currents != NULL)
+      delete [] _thread_currents;
 
-  if (fwd) {
-    if (curr_segment->_cmfd_surface_fwd != -1) {
+    /* Pad each thread's currents to a multiple of 64 bytes */
+    long padding = 64 / sizeof(FP_PRECISION);
+    _thread_currents_stride = (num_currents + padding) / padding * padding;
+    _num_threads = num_threads;
 
-      surf_id = curr_segment->_cmfd_surface_fwd % NUM_SURFACES;
-      cell_id = curr_segment->_cmfd_surface_fwd / NUM_SURFACES;
+    try {
+      _thread_currents = new FP_PRECISION[_num_threads *
+                                          _thread_currents_stride];
+    }
+    catch (std::exception &e) {
+      log_printf(ERROR, "Could not allocate memory for the surface currents "
+                 "of %d threads. Backtrace:%s", _num_threads, e.what());
+    }
+  }
 
-      for (int e=0; e < _num_moc_groups; e++) {
-        int g = getCmfdGroup(e);
+#pragma omp parallel for schedule(static)
+  for (int t=0; t < _num_threads; t++)
+    memset(&_thread_currents[t * _thread_currents_stride], 0,
+           num_currents * sizeof(FP_PRECISION));
+}
 
-        for (int p=0; p < _num_polar_2; p++)
-          currents[g] += track_flux(p, e) *
-                         _quadrature->getWeightInline(azim_index, p);
-      }
 
-      /* Increment currents */
-      _surface_currents->incrementValues
-          (cell_id, surf_id*ncg, (surf_id+1)*ncg - 1, currents);
-    }
-  }
-  else {
-    if (curr_segment->_cmfd_surface_bwd != -1) {
+/**
+ * @brief Sums the surface currents tallied by each thread into the surface
+ *        currents for each mesh cell and energy group.
+ * @details This method is called once after each transport sweep.
+ */
+void Cmfd::reduceCurrents() {
 
-      surf_id = curr_segment->_cmfd_surface_bwd % NUM_SURFACES;
-      cell_id = curr_segment->_cmfd_surface_bwd / NUM_SURFACES;
+  if (_thread_currents == NULL)
+    return;
 
-      for (int e=0; e < _num_moc_groups; e++) {
+  long num_currents = (long)getNumCells() * NUM_SURFACES * _num_cmfd_groups;
+  FP_PRECISION* currents = _surface_currents->getArray();
 
-        int g = getCmfdGroup(e);
+#pragma omp parallel for schedule(static)
+  for (long i=0; i < num_currents; i++) {
+    FP_PRECISION current = 0.;
+    for (int t=0; t < _num_threads; t++)
+      current += _thread_currents[t * _thread_currents_stride + i];
+    currents[i] = current;
+  }
+}
 
-        for (int p=0; p < _num_polar_2; p++)
-          currents[g] += track_flux(p, e) *
-                         _quadrature->getWeightInline(azim_index, p);
-      }
 
-      /* Increment currents */
-      _surface_currents->incrementValues
-          (cell_id, surf_id*ncg, (surf_id+1)*ncg - 1, currents);
+/**
+ * @brief Tallies the current contribution from a segment across the
+ *        the appropriate CMFD mesh cell surface.
+ * @details The current is tallied into the calling thread's copy of the
+ *          surface currents without locking.
+ * @param cmfd_surface The CMFD mesh surface crossed by the segment in the
+ *        direction of integration (-1 if no surface is crossed)
+ * @param track_flux The outgoing angular flux for this segment
+ * @param azim_index Azimuthal angle index of the current Track
+ */
+void Cmfd::tallyCurrent(int cmfd_surface, FP_PRECISION* track_flux,
+                        int azim_index) {
+
+  if (cmfd_surface == -1)
+    return;
+
+  int surf_id = cmfd_surface % NUM_SURFACES;
+  int cell_id = cmfd_surface / NUM_SURFACES;
+  FP_PRECISION* currents = &_thread_currents
+      [omp_get_thread_num() * _thread_currents_stride +
+       ((long)cell_id * NUM_SURFACES + surf_id) * _num_cmfd_groups];
+
+  /* Sum the current over the MOC groups in each CMFD group */
+  int e = 0;
+  while (e < _num_moc_groups) {
+    int g = getCmfdGroup(e);
+    FP_PRECISION current = 0.;
+
+    for (; e < _num_moc_groups && getCmfdGroup(e) == g; e++) {
+      for (int p=0; p < _num_polar_2; p++)
+        current += track_flux(p, e) *
+                   _quadrature->getWeightInline(azim_index, p);
     }
+
+    currents[g] += current;
   }
 }
 
@@ -1967,6 +2085,9 @@ void Cmfd::initialize() {
     _x_min = _geometry->getMinX();
     _y_min = _geometry->getMinY();
 
+    /* Find the Track end CMFD cells again on the next boundary update */
+    _track_end_cells.clear();
+
     /* Initialize k-nearest stencils, currents, flux, and materials */
     generateKNearestStencils();
     initializeCurrents();
@@ -143,9 +143,30 @@ private:
   /** Vector of surface currents for each CMFD cell */
   Vector* _surface_currents;
 
+  /** The number of threads with surface current tallies */
+  int _num_threads;
+
+  /** The number of entries in each thread's surface current tallies,
+   *  padded to prevent false sharing between threads */
+  long _thread_currents_stride;
+
+  /** Surface currents tallied by each thread during a transport sweep */
+  FP_PRECISION* _thread_currents;
+
   /** Vector of vectors of FSRs containing in each cell */
   std::vector< std::vector<int> > _cell_fsrs;
 
+  /** The CMFD cell containing each FSR, built from _cell_fsrs on demand */
+  std::vector<int> _FSR_cells;
+
+  /** The CMFD cell whose flux ratio rescales the incoming boundary flux at
+   *  the start (2*i) and end (2*i+1) of each Track i, or -1 for vacuum */
+  std::vector<int> _track_end_cells;
+
+  /** The ratio of new to old CMFD flux in each CMFD cell, expanded to the
+   *  MOC energy groups */
+  std::vector<FP_PRECISION> _boundary_flux_ratios;
+
   /** Pointer to Lattice object representing the CMFD mesh */
   Lattice* _lattice;
 
@@ -177,6 +198,9 @@ private:
   void initializeMaterials();
   void initializeCurrents();
   void generateKNearestStencils();
+  void initializeFSRCells();
+  void initializeTrackEndCells(Track** tracks, segment_arrays* segments,
+                               int num_tracks);
 
   /* Private getter functions */
   int getCellNext(int cell_id, int surface_id);
@@ -207,10 +231,12 @@ public:
   int findCmfdSurface(int cell_id, LocalCoords* coords);
   void addFSRToCell(int cell_id, int fsr_id);
   void zeroCurrents();
-  void tallyCurrent(segment* curr_segment, FP_PRECISION* track_flux,
-                    int azim_index, bool fwd);
-  void updateBoundaryFlux(Track** tracks, FP_PRECISION* boundary_flux,
-                          int num_tracks);
+  void reduceCurrents();
+  void tallyCurrent(int cmfd_surface, FP_PRECISION* track_flux,
+                    int azim_index);
+  void updateBoundaryFlux(Track** tracks, segment_arrays* segments,
+                          FP_PRECISION* boundary_flux,
+                          long* boundary_flux_offsets, int num_tracks);
 
   /* Get parameters */
   int getNumCmfdGroups();
@@ -20,6 +20,10 @@ Geometry::Geometry() {
 
   /* Initialize CMFD object to NULL */
   _cmfd = NULL;
+
+  /* The bounds and nesting depth are cached once the Geometry is complete */
+  _bounds_cached = false;
+  _max_nesting_depth = 0;
 }
 
 
@@ -38,6 +42,8 @@ Geometry::~Geometry() {
 
     _FSR_keys_map.clear();
     _FSRs_to_keys.clear();
+    _FSRs_to_data.clear();
+    _FSR_index.clear();
   }
 
   /* Remove all Materials in the Geometry */
@@ -191,6 +197,54 @@ int Geometry::getNumFSRs() {
   return _FSRs_to_keys.size();
 }
 
+
+/**
+ * @brief Computes the number of levels of nested Universes and Lattices
+ *        below and including a Universe.
+ * @param univ a pointer to the Universe of interest
+ * @return the maximum number of levels below and including the Universe
+ */
+static int computeNestingDepth(Universe* univ) {
+
+  int depth = 0;
+
+  if (univ->getType() == LATTICE) {
+    std::map<int, Universe*> universes =
+        static_cast<Lattice*>(univ)->getUniqueUniverses();
+    std::map<int, Universe*>::iterator iter;
+    for (iter = universes.begin(); iter != universes.end(); ++iter)
+      depth = std::max(depth, computeNestingDepth(iter->second));
+  }
+  else {
+    std::map<int, Cell*> cells = univ->getCells();
+    std::map<int, Cell*>::iterator iter;
+    for (iter = cells.begin(); iter != cells.end(); ++iter) {
+      if (iter->second->getType() == FILL)
+        depth = std::max(depth,
+                         computeNestingDepth(iter->second->getFillUniverse()));
+    }
+  }
+
+  return depth + 1;
+}
+
+
+/**
+ * @brief Returns the maximum number of levels of nested Universes and
+ *        Lattices in the Geometry.
+ * @details This is the maximum length of a LocalCoords linked list built by
+ *          findCellContainingCoords(). It is computed once the Cells have
+ *          been subdivided by initializeFSRs().
+ * @return the maximum nesting depth of the Geometry
+ */
+int Geometry::getMaxNestingDepth() {
+
+  if (_max_nesting_depth == 0)
+    return computeNestingDepth(_root_universe);
+
+  return _max_nesting_depth;
+}
+
 /**
  * @brief Returns the number of energy groups for each Material's nuclear data.
  * @return the number of energy groups
@@ -390,6 +444,8 @@ Cmfd* Geometry::getCmfd() {
  */
 void Geometry::setRootUniverse(Universe* root_universe) {
   _root_universe = root_universe;
+  _bounds_cached = false;
+  _max_nesting_depth = 0;
 }
 
 
@@ -415,11 +471,20 @@ void Geometry::setCmfd(Cmfd* cmfd) {
  *          or Universe that it is in. If the LocalCoords is outside the bounds
  *          of the Geometry or on the boundaries this method will return NULL;
  *          otherwise it will return a pointer to the Cell that is found by the
- *          recursive Geometry::findCell(...) method.
+ *          recursive Geometry::findCell(...) method. LocalCoords already
+ *          in the linked list are reused rather than reallocated.
  * @param coords pointer to a LocalCoords object
+ * @param moved whether the LocalCoords linked list was found by a previous
+ *        search and then moved across at most one Surface, or any distance
+ *        if the search is strict, in which case the Cells it was previously
+ *        in are used to speed up the search
+ * @param strict whether the Cells the LocalCoords were previously in are
+ *        only kept if they are not on their Surfaces, which always finds
+ *        the same Cell as a search from scratch
  * @return returns a pointer to a Cell if found, NULL if no Cell found
  */
-Cell* Geometry::findCellContainingCoords(LocalCoords* coords) {
+Cell* Geometry::findCellContainingCoords(LocalCoords* coords, bool moved,
+                                         bool strict) {
 
   Universe* univ = coords->getUniverse();
   Cell* cell;
@@ -430,9 +495,9 @@ Cell* Geometry::findCellContainingCoords(LocalCoords* coords) {
   }
 
   if (univ->getType() == SIMPLE)
-    cell = univ->findCell(coords);
+    cell = univ->findCell(coords, moved, strict);
   else
-    cell = static_cast<Lattice*>(univ)->findCell(coords);
+    cell = static_cast<Lattice*>(univ)->findCell(coords, moved, strict);
 
   return cell;
 }
@@ -482,7 +547,9 @@ Material* Geometry::findFSRMaterial(int fsr_id) {
  *          LocalCoords is outside the bounds of the Geometry or on the
  *          boundaries this method will return NULL; otherwise it will return
  *          a pointer to the Cell that the LocalCoords will reach next along
- *          its trajectory.
+ *          its trajectory. The linked list of LocalCoords is kept so that
+ *          the levels at which the LocalCoords stays in the same Cell or
+ *          Lattice cell are not searched again.
  * @param coords pointer to a LocalCoords object
  * @return a pointer to a Cell if found, NULL if no Cell found
  */
@@ -534,7 +601,6 @@ Cell* Geometry::findNextCell(LocalCoords* coords) {
     }
 
     coords = coords->getHighestLevel();
-    coords->prune();
 
     /* Check for distance to nearest CMFD mesh cell boundary */
     if (_cmfd != NULL) {
@@ -543,10 +609,11 @@ Cell* Geometry::findNextCell(LocalCoords* coords) {
       min_dist = std::min(dist, min_dist);
     }
 
-    /* Move point and get next cell */
+    /* Move point and get next cell, only searching again from the highest
+     * level at which the point left its previous Cell or Lattice cell */
     coords->adjustCoords(min_dist + TINY_MOVE);
 
-    return findCellContainingCoords(coords);
+    return findCellContainingCoords(coords, true);
   }
 }
 
@@ -564,19 +631,24 @@ int Geometry::findFSRId(LocalCoords* coords) {
   curr = coords->getLowestLevel();
 
   /* Generate unique FSR key */
-  std::string fsr_key = getFSRKey(coords);
+  fsr_key key = getFSRKey(coords);
+
+  /* FSRs found before the last call to initializeFSRIndex() are looked up
+   * in the frozen index without touching the hash map */
+  if (_FSR_index.find(key, fsr_id))
+    return fsr_id;
 
   /* If FSR has not been encountered, update FSR maps and vectors */
-  if (!_FSR_keys_map.contains(fsr_key)) {
+  if (!_FSR_keys_map.contains(key)) {
 
     /* Try to get a clean copy of the fsr_id, adding the FSR data
        if necessary where -1 indicates the key was already added */
-    fsr_id = _FSR_keys_map.insert_and_get_count(fsr_key, NULL);
+    fsr_id = _FSR_keys_map.insert_and_get_count(key, NULL);
     if (fsr_id == -1)
     {
       fsr_data volatile* fsr;
       do {
-        fsr = _FSR_keys_map.at(fsr_key);
+        fsr = _FSR_keys_map.at(key);
       } while (fsr == NULL);
       fsr_id = fsr->_fsr_id;
     }
@@ -585,7 +657,7 @@ int Geometry::findFSRId(LocalCoords* coords) {
       /* Add FSR information to FSR key map and FSR_to vectors */
       fsr_data* fsr = new fsr_data;
       fsr->_fsr_id = fsr_id;
-      _FSR_keys_map.update(fsr_key, fsr);
+      _FSR_keys_map.update(key, fsr);
       Point* point = new Point();
       point->setCoords(coords->getHighestLevel()->getX(),
                        coords->getHighestLevel()->getY(),
@@ -606,7 +678,7 @@ int Geometry::findFSRId(LocalCoords* coords) {
   else {
     fsr_data volatile* fsr;
     do {
-      fsr = _FSR_keys_map.at(fsr_key);
+      fsr = _FSR_keys_map.at(key);
     } while (fsr == NULL);
 
     fsr_id = fsr->_fsr_id;
@@ -619,27 +691,65 @@ int Geometry::findFSRId(LocalCoords* coords) {
 /**
  * @brief Return the ID of the flat source region that a given
  *        LocalCoords object resides within.
+ * @details Once the FSRs have been indexed by initializeFSRIndex() the
+ *          lookup takes no locks and allocates no memory, so this may be
+ *          called from many threads at once.
  * @param coords a LocalCoords object pointer
  * @return the FSR ID for a given LocalCoords object
  */
 int Geometry::getFSRId(LocalCoords* coords) {
 
-  int fsr_id = 0;
-  std::string fsr_key;
+  int fsr_id = searchFSRId(coords);
 
-  try {
-    fsr_key = getFSRKey(coords);
-    fsr_id = _FSR_keys_map.at(fsr_key)->_fsr_id;
-  }
-  catch(std::exception &e) {
+  if (fsr_id < 0)
     log_printf(ERROR, "Could not find FSR ID with key: %s. Try creating "
-               "geometry with finer track spacing", fsr_key.c_str());
-  }
+               "geometry with finer track spacing",
+               getFSRKeyString(coords).c_str());
 
   return fsr_id;
 }
 
 
+/**
+ * @brief Return the ID of the flat source region that a given
+ *        LocalCoords object resides within if it has been found.
+ * @details The frozen index is searched without locks first, and the hash
+ *          map only for FSRs found since the index was built.
+ * @param coords a LocalCoords object pointer
+ * @return the FSR ID, or -1 if the FSR has not been found by ray tracing
+ */
+int Geometry::searchFSRId(LocalCoords* coords) {
+
+  int fsr_id;
+  fsr_key key = getFSRKey(coords);
+
+  if (_FSR_index.find(key, fsr_id))
+    return fsr_id;
+
+  if (!_FSR_keys_map.contains(key))
+    return -1;
+
+  fsr_data* fsr = _FSR_keys_map.at(key);
+  return (fsr == NULL) ? -1 : fsr->_fsr_id;
+}
+
+
+/**
+ * @brief Return the fsr_data struct for a given FSR ID.
+ * @details The struct is taken from the vector indexed by FSR ID if the
+ *          FSRs have been indexed, and is looked up by key otherwise.
+ * @param fsr_id the FSR ID
+ * @return a pointer to the FSR's fsr_data struct
+ */
+fsr_data* Geometry::getFSRData(int fsr_id) {
+
+  if (fsr_id >= 0 && fsr_id < (int) _FSRs_to_data.size())
+    return _FSRs_to_data[fsr_id];
+
+  return _FSR_keys_map.at(_FSRs_to_keys.at(fsr_id));
+}
+
+
 /**
  * @brief Return the characteristic point for a given FSR ID
  * @param fsr_id the FSR ID
@@ -650,7 +760,7 @@ Point* Geometry::getFSRPoint(int fsr_id) {
   Point* point;
 
   try {
-    point = _FSR_keys_map.at(_FSRs_to_keys.at(fsr_id))->_point;
+    point = getFSRData(fsr_id)->_point;
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not find characteristic point in FSR: %d", fsr_id);
@@ -670,7 +780,7 @@ Point* Geometry::getFSRCentroid(int fsr_id) {
   Point* point;
 
   try {
-    point = _FSR_keys_map.at(_FSRs_to_keys.at(fsr_id))->_centroid;
+    point = getFSRData(fsr_id)->_centroid;
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not find centroid in FSR: %d.", fsr_id);
@@ -681,17 +791,110 @@ Point* Geometry::getFSRCentroid(int fsr_id) {
 
 
 /**
- * @brief Generate a string FSR "key" that identifies an FSR by its
- *        unique hierarchical lattice/universe/cell structure.
+ * @enum fsrKeyLevel
+ * @brief The type of each level of the hierarchy added to an FSR key.
+ */
+enum fsrKeyLevel {
+  FSR_KEY_CMFD = 1,
+  FSR_KEY_LATTICE,
+  FSR_KEY_UNIVERSE,
+  FSR_KEY_CELL
+};
+
+
+/**
+ * @brief Adds an integer to an FSR key.
+ * @details The first half of the key is an FNV-1a hash of the integers and
+ *          the second half mixes each integer with the SplitMix64 finalizer
+ *          so that its low bits are suitable as a hash table index.
+ * @param key the FSR key
+ * @param value the integer to add to the key
+ */
+static inline void addToFSRKey(fsr_key& key, long value) {
+
+  uint64_t token = (uint64_t) value;
+  key._hash1 = (key._hash1 ^ token) * 1099511628211ULL;
+
+  uint64_t z = key._hash2 + token + 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  key._hash2 = z ^ (z >> 31);
+}
+
+
+/**
+ * @brief Generate an FSR key that identifies an FSR by its unique
+ *        hierarchical lattice/universe/cell structure.
  * @details Since not all FSRs will reside on the absolute lowest universe
  *          level and Cells might overlap other cells, it is important to
  *          have a method for uniquely identifying FSRs. This method
- *          creates a unique FSR key by constructing a structured string
- *          that describes the hierarchy of lattices/universes/cells.
+ *          creates a unique FSR key by hashing the CMFD cell and the
+ *          lattice IDs and cells, universe IDs and cell ID along the
+ *          hierarchy of lattices/universes/cells. Each level is prefixed
+ *          by its type so that different hierarchies hash different
+ *          sequences of integers.
  * @param coords a LocalCoords object pointer
  * @return the FSR key
  */
-std::string Geometry::getFSRKey(LocalCoords* coords) {
+fsr_key Geometry::getFSRKey(LocalCoords* coords) {
+
+  fsr_key key;
+  key._hash1 = 14695981039346656037ULL;
+  key._hash2 = 0;
+  LocalCoords* curr = coords->getHighestLevel();
+
+  /* If CMFD is on, add the CMFD lattice cell to the key */
+  if (_cmfd != NULL) {
+    addToFSRKey(key, FSR_KEY_CMFD);
+    addToFSRKey(key, _cmfd->getLattice()->getLatX(curr->getPoint()));
+    addToFSRKey(key, _cmfd->getLattice()->getLatY(curr->getPoint()));
+  }
+
+  /* Descend the linked list hierarchy until the lowest level has
+   * been reached */
+  while (curr != NULL) {
+
+    if (curr->getType() == LAT) {
+
+      /* Add the lattice ID and lattice cell to the key */
+      addToFSRKey(key, FSR_KEY_LATTICE);
+      addToFSRKey(key, curr->getLattice()->getId());
+      addToFSRKey(key, curr->getLatticeX());
+      addToFSRKey(key, curr->getLatticeY());
+      addToFSRKey(key, curr->getLatticeZ());
+    }
+    else {
+
+      /* Add the universe ID to the key */
+      addToFSRKey(key, FSR_KEY_UNIVERSE);
+      addToFSRKey(key, curr->getUniverse()->getId());
+    }
+
+    /* If lowest coords reached break; otherwise get next coords */
+    if (curr->getNext() == NULL)
+      break;
+    else
+      curr = curr->getNext();
+  }
+
+  /* Add the cell ID to the key */
+  addToFSRKey(key, FSR_KEY_CELL);
+  addToFSRKey(key, curr->getCell()->getId());
+
+  return key;
+}
+
+
+/**
+ * @brief Generate a human-readable string describing the unique
+ *        hierarchical lattice/universe/cell structure of an FSR.
+ * @details The string contains the same hierarchy as the FSR key returned
+ *          by Geometry::getFSRKey(...) and is intended for plotting and
+ *          debugging rather than for identifying FSRs during ray tracing.
+ * @param coords a LocalCoords object pointer
+ * @return the FSR key string
+ */
+std::string Geometry::getFSRKeyString(LocalCoords* coords) {
 
   std::stringstream key;
   LocalCoords* curr = coords->getHighestLevel();
@@ -781,12 +984,28 @@ void Geometry::subdivideCells() {
  *        initialize CMFD.
  * @details This method is intended to be called by the user before initiating
  *          source iteration. This method first subdivides all Cells by calling
- *          the Geometry::subdivideCells() method. Then it initializes the CMFD
- *          object.
+ *          the Geometry::subdivideCells() method. Then it builds the index of
+ *          Cells in each Universe used to speed up the search for the Cell
+ *          containing a point and caches the bounds and nesting depth of the
+ *          Geometry.
  */
 void Geometry::initializeFSRs() {
   /* Subdivide Cells into sectors and rings */
   subdivideCells();
+
+  /* Build the Cell index of each Universe in the subdivided Geometry */
+  std::map<int, Universe*> universes = getAllUniverses();
+  std::map<int, Universe*>::iterator iter;
+  for (iter = universes.begin(); iter != universes.end(); ++iter)
+    iter->second->buildCellIndex();
+
+  /* Cache the nesting depth and the bounds checked each time a point is
+   * located */
+  _max_nesting_depth = computeNestingDepth(_root_universe);
+  double bounds[6] = {getMinX(), getMaxX(), getMinY(), getMaxY(),
+                      getMinZ(), getMaxZ()};
+  std::copy(bounds, bounds + 6, _bounds);
+  _bounds_cached = true;
 }
 
 
@@ -796,9 +1015,13 @@ void Geometry::initializeFSRs() {
  * @details This method starts at the beginning of a Track and finds successive
  *          intersection points with FSRs as the Track crosses through the
  *          Geometry and creates segment structs and adds them to the Track.
+ *          The LocalCoords below the highest level are taken from the
+ *          levels array if one is given so that the heap is not touched.
  * @param track a pointer to a track to segmentize
+ * @param levels an array of 2 * (getMaxNestingDepth() - 1) LocalCoords for
+ *        the lower levels of the segments' start and end, or NULL
  */
-void Geometry::segmentize(Track* track) {
+void Geometry::segmentize(Track* track, LocalCoords* levels) {
 
   /* Track starting Point coordinates and azimuthal angle */
   double x0 = track->getStart()->getX();
@@ -821,6 +1044,13 @@ void Geometry::segmentize(Track* track) {
   start.setPhi(phi);
   end.setPhi(phi);
 
+  /* Take the lower levels of the start and end from the levels array */
+  if (levels != NULL) {
+    int num_levels = getMaxNestingDepth() - 1;
+    start.setLevels(levels, num_levels);
+    end.setLevels(levels + num_levels, num_levels);
+  }
+
   /* Find the Cell containing the Track starting Point */
   Cell* curr = findFirstCell(&end);
   Cell* prev;
@@ -853,10 +1083,10 @@ void Geometry::segmentize(Track* track) {
     fsr_id = findFSRId(&start);
 
     /* Create a new Track segment */
-    segment* new_segment = new segment;
-    new_segment->_material = material;
-    new_segment->_length = length;
-    new_segment->_region_id = fsr_id;
+    segment new_segment;
+    new_segment._material = material;
+    new_segment._length = length;
+    new_segment._region_id = fsr_id;
 
     log_printf(DEBUG, "segment start x = %f, y = %f; end x = %f, y = %f",
                start.getX(), start.getY(), end.getX(), end.getY());
@@ -872,8 +1102,8 @@ void Geometry::segmentize(Track* track) {
       start.adjustCoords(-TINY_MOVE);
       end.adjustCoords(-TINY_MOVE);
 
-      new_segment->_cmfd_surface_fwd = _cmfd->findCmfdSurface(cmfd_cell, &end);
-      new_segment->_cmfd_surface_bwd =
+      new_segment._cmfd_surface_fwd = _cmfd->findCmfdSurface(cmfd_cell, &end);
+      new_segment._cmfd_surface_bwd =
         _cmfd->findCmfdSurface(cmfd_cell, &start);
 
       /* Re-nudge segments from surface */
@@ -882,7 +1112,7 @@ void Geometry::segmentize(Track* track) {
     }
 
     /* Add the segment to the Track */
-    track->addSegment(new_segment);
+    track->addSegment(&new_segment);
   }
 
   log_printf(DEBUG, "Created %d segments for Track: %s",
@@ -905,27 +1135,27 @@ void Geometry::segmentize(Track* track) {
 void Geometry::initializeFSRVectors() {
 
   /* get keys and values from map */
-  std::string *key_list = _FSR_keys_map.keys();
+  fsr_key *key_list = _FSR_keys_map.keys();
   fsr_data **value_list = _FSR_keys_map.values();
 
   /* allocate vectors */
   int num_FSRs = _FSR_keys_map.size();
-  _FSRs_to_keys = std::vector<std::string>(num_FSRs);
+  _FSRs_to_keys = std::vector<fsr_key>(num_FSRs);
 
   /* fill vectors key and material ID information */
 #pragma omp parallel for
   for (int i=0; i < num_FSRs; i++) {
-    std::string key = key_list[i];
+    fsr_key key = key_list[i];
     fsr_data* fsr = value_list[i];
     int fsr_id = fsr->_fsr_id;
     _FSRs_to_keys.at(fsr_id) = key;
   }
 
-  /* add cmfd information serially */
+  /* add cmfd information serially in order of FSR ID so that the order
+   * of the FSRs in each CMFD cell does not depend on the key hashes */
   if (_cmfd != NULL) {
-    for (int i=0; i < num_FSRs; i++) {
-      fsr_data* fsr = value_list[i];
-      int fsr_id = fsr->_fsr_id;
+    for (int fsr_id=0; fsr_id < num_FSRs; fsr_id++) {
+      fsr_data* fsr = _FSR_keys_map.at(_FSRs_to_keys.at(fsr_id));
       _cmfd->addFSRToCell(fsr->_cmfd_cell, fsr_id);
     }
   }
@@ -933,6 +1163,32 @@ void Geometry::initializeFSRVectors() {
   /* Delete key and value lists */
   delete[] key_list;
   delete[] value_list;
+
+  initializeFSRIndex();
+}
+
+
+/**
+ * @brief Builds the read-only index of FSR IDs by FSR key.
+ * @details This is called once the FSRs have all been identified, either by
+ *          initializeFSRVectors() after ray tracing or by the TrackGenerator
+ *          after reading Tracks from a file. Lookups of these FSRs by
+ *          findFSRId() and getFSRId() then search a flat open addressing
+ *          table without taking locks or allocating memory, and the
+ *          fsr_data for each FSR ID is found without hashing.
+ */
+void Geometry::initializeFSRIndex() {
+
+  int num_FSRs = _FSRs_to_keys.size();
+  std::vector<int> fsr_ids(num_FSRs);
+  _FSRs_to_data.resize(num_FSRs);
+
+  for (int fsr_id=0; fsr_id < num_FSRs; fsr_id++) {
+    fsr_ids[fsr_id] = fsr_id;
+    _FSRs_to_data[fsr_id] = _FSR_keys_map.at(_FSRs_to_keys[fsr_id]);
+  }
+
+  _FSR_index.build(_FSRs_to_keys.data(), fsr_ids.data(), num_FSRs);
 }
 
 
@@ -1005,6 +1261,118 @@ void Geometry::computeFissionability(Universe* univ) {
 }
 
 
+/**
+ * @brief Finds the FSR, Cell and Material IDs at many points.
+ * @details This is the batched form of findCellContainingCoords() and
+ *          getFSRId() for post-processing, such as plotting and mesh tallies,
+ *          over very many points. The points are divided into contiguous
+ *          blocks among the OpenMP threads. Each thread keeps the LocalCoords
+ *          linked list of the previous point in its block, so that when the
+ *          points are sorted or lie on a grid the Lattice cells and Cells at
+ *          each level are usually reused rather than searched from the root.
+ *          A Cell is only reused for points which are not on its Surfaces,
+ *          so the IDs do not depend on the order of the points or the
+ *          number of threads. The IDs for each point are returned in
+ *          consecutive entries of the domains array in the order FSR ID,
+ *          Cell ID and Material ID. Points outside the Geometry have IDs of
+ *          -1, as do points in FSRs which were not crossed by any Track. This
+ *          method may be called from Python as follows:
+ *
+ * @code
+ *          points = numpy.array([[0.1, 0.2], [0.3, 0.4]])
+ *          domains = geometry.findDomainsAtPoints(points, 3 * len(points))
+ *          fsr_ids, cell_ids, material_ids = domains.reshape(-1, 3).T
+ * @endcode
+ *
+ * @param points an array of the x and y (and optionally z) coordinates of
+ *        each point
+ * @param num_points the number of points
+ * @param num_dims the number of coordinates of each point (2 or 3)
+ * @param domains an array of length 3 * num_points for the domain IDs
+ * @param num_domains the length of the domains array
+ * @param zcoord the z-coordinate of the points if only x and y are given
+ */
+void Geometry::findDomainsAtPoints(double* points, int num_points,
+                                   int num_dims, int* domains,
+                                   int num_domains, double zcoord) {
+
+  if (num_dims != 2 && num_dims != 3)
+    log_printf(ERROR, "Unable to find the domains at points with %d "
+               "coordinates since only 2 or 3 coordinates are supported",
+               num_dims);
+
+  if (num_domains != 3 * num_points)
+    log_printf(ERROR, "Unable to find the domains at %d points in an array "
+               "of length %d rather than %d", num_points, num_domains,
+               3 * num_points);
+
+  locatePoints(points, num_points, num_dims, zcoord, domains);
+}
+
+
+/**
+ * @brief Finds the FSR, Cell and Material IDs at many points.
+ * @details This performs the search for findDomainsAtPoints() without
+ *          checking its arguments, writing the FSR, Cell and Material IDs of
+ *          point i to domains[3*i], domains[3*i+1] and domains[3*i+2].
+ * @param points an array of num_dims coordinates for each point
+ * @param num_points the number of points
+ * @param num_dims the number of coordinates of each point (2 or 3)
+ * @param zcoord the z-coordinate of the points if num_dims is 2
+ * @param domains an array of length 3 * num_points for the domain IDs
+ */
+void Geometry::locatePoints(double* points, int num_points, int num_dims,
+                            double zcoord, int* domains) {
+
+  /* The number of LocalCoords below the highest level */
+  int num_levels = getMaxNestingDepth() - 1;
+
+#pragma omp parallel
+  {
+    /* Each thread locates points with LocalCoords from its own array rather
+     * than allocating them on the heap for each point */
+    std::vector<LocalCoords> levels(num_levels, LocalCoords(0., 0., 0.));
+    LocalCoords point(0., 0., 0.);
+    point.setUniverse(_root_universe);
+    point.setLevels(levels.data(), num_levels);
+
+    /* Whether the LocalCoords hold the previous point's Cells */
+    bool reuse = false;
+
+#pragma omp for schedule(static)
+    for (int i=0; i < num_points; i++) {
+
+      double* xyz = &points[i*num_dims];
+      double z = (num_dims == 3) ? xyz[2] : zcoord;
+      point.setX(xyz[0]);
+      point.setY(xyz[1]);
+      point.setZ(z);
+
+      /* Keep the previous point's Cells and Lattice cells at each level at
+       * which this point is strictly inside them */
+      Cell* cell = findCellContainingCoords(&point, reuse, true);
+
+      /* Points outside the Geometry have no domains */
+      reuse = (cell != NULL);
+      int* point_domains = &domains[3 * (long) i];
+      if (cell == NULL) {
+        point_domains[0] = -1;
+        point_domains[1] = -1;
+        point_domains[2] = -1;
+        continue;
+      }
+
+      point_domains[0] = searchFSRId(&point);
+      point_domains[1] = cell->getId();
+      point_domains[2] = cell->getFillMaterial()->getId();
+    }
+
+    /* Free any LocalCoords which did not fit in the array */
+    point.prune();
+  }
+}
+
+
 /**
  * @brief Get the material, cell or FSR IDs on a 2D spatial grid.
  * @details This is a helper method for the openmoc.plotter module.
@@ -1034,85 +1402,46 @@ std::vector<int> Geometry::getSpatialDataOnGrid(std::vector<double> grid_x,
 						double zcoord,
 						const char* domain_type) {
 
-  LocalCoords* point;
-  Cell* cell;
+  /* Determine the type of domain before searching the grid */
+  int type = 0;
+  if (strcmp(domain_type, "fsr") == 0)
+    type = 0;
+  else if (strcmp(domain_type, "cell") == 0)
+    type = 1;
+  else if (strcmp(domain_type, "material") == 0)
+    type = 2;
+  else
+    log_printf(ERROR, "Unable to extract spatial data for "
+	       "unsupported domain type %s", domain_type);
 
-  /* Instantiate a vector to hold the domain IDs */
+  /* List the points with x varying fastest so that neighboring points
+   * share most of their Cells */
   int num_x = grid_x.size();
   int num_y = grid_y.size();
-  std::vector<int> domains(num_x * num_y);
-
-  /* Extract the source region IDs */
-  if (strcmp(domain_type, "fsr") == 0) {
-
-#pragma omp parallel for private(point, cell)
-    for (int i=0; i < num_x; i++) {
-      for (int j=0; j < num_y; j++) {
-
-	/* Find the Cell containing this point */
-	point = new LocalCoords(grid_x[i], grid_y[j], zcoord);
-	point->setUniverse(_root_universe);
-	cell = findCellContainingCoords(point);
-
-	/* Extract the ID of the domain of interest */
-	domains[i+j*num_x] = getFSRId(point);
-
-	/* Deallocate memory for LocalCoords */
-	point = point->getHighestLevel();
-	point->prune();
-      }
-    }
-  }
-
-  /* Extract the material IDs */
-  else if (strcmp(domain_type, "material") == 0) {
-
-#pragma omp parallel for private(point, cell)
+  std::vector<double> points(2 * num_x * num_y);
+  for (int j=0; j < num_y; j++) {
     for (int i=0; i < num_x; i++) {
-      for (int j=0; j < num_y; j++) {
-
-	/* Find the Cell containing this point */
-	point = new LocalCoords(grid_x[i], grid_y[j], zcoord);
-	point->setUniverse(_root_universe);
-	cell = findCellContainingCoords(point);
-
-	/* Extract the ID of the domain of interest */
-	Material* fill = cell->getFillMaterial();	
-	domains[i+j*num_x] = cell->getFillMaterial()->getId();
-
-	/* Deallocate memory for LocalCoords */
-	point = point->getHighestLevel();
-	point->prune();
-      }
+      points[2*(i+j*num_x)] = grid_x[i];
+      points[2*(i+j*num_x)+1] = grid_y[j];
     }
   }
 
-  /* Extract the cell IDs */
-  else if (strcmp(domain_type, "cell") == 0) {
-
-#pragma omp parallel for private(point, cell)
-    for (int i=0; i < num_x; i++) {
-      for (int j=0; j < num_y; j++) {
+  /* Find the FSR, Cell and Material IDs at each point */
+  std::vector<int> all_domains(3 * num_x * num_y);
+  locatePoints(points.data(), num_x * num_y, 2, zcoord, all_domains.data());
 
-	/* Find the Cell containing this point */
-	point = new LocalCoords(grid_x[i], grid_y[j], zcoord);
-	point->setUniverse(_root_universe);
-	cell = findCellContainingCoords(point);
-
-	/* Extract the ID of the domain of interest */
-	domains[i+j*num_x] = cell->getId();
-
-	/* Deallocate memory for LocalCoords */
-	point = point->getHighestLevel();
-	point->prune();
-      }
-    }
+  /* Extract the domain IDs of interest */
+  std::vector<int> domains(num_x * num_y);
+  for (int i=0; i < num_x * num_y; i++) {
+    domains[i] = all_domains[3*i + type];
+
+    /* Points inside the Geometry must be in an FSR found by ray tracing */
+    if (type == 0 && domains[i] < 0 && all_domains[3*i+1] >= 0)
+      log_printf(ERROR, "Could not find an FSR ID at (%f, %f). Try "
+                 "creating geometry with finer track spacing",
+                 points[2*i], points[2*i+1]);
   }
 
- else
-   log_printf(ERROR, "Unable to extract spatial data for "
-	      "unsupported domain type %s", domain_type);
-
   /* Return the domain IDs */
   return domains;
 }
@@ -1218,7 +1547,7 @@ void Geometry::initializeCmfd() {
  * @brief Returns a pointer to the map that maps FSR keys to FSR IDs
  * @return pointer to _FSR_keys_map map of FSR keys to FSR IDs
  */
-ParallelHashMap<std::string, fsr_data*>& Geometry::getFSRKeysMap() {
+ParallelHashMap<fsr_key, fsr_data*>& Geometry::getFSRKeysMap() {
   return _FSR_keys_map;
 }
 
@@ -1227,7 +1556,7 @@ ParallelHashMap<std::string, fsr_data*>& Geometry::getFSRKeysMap() {
  * @brief Returns the vector that maps FSR IDs to FSR key hashes
  * @return _FSR_keys_map map of FSR keys to FSR IDs
  */
-std::vector<std::string>& Geometry::getFSRsToKeys() {
+std::vector<fsr_key>& Geometry::getFSRsToKeys() {
   return _FSRs_to_keys;
 }
 
@@ -1243,6 +1572,15 @@ bool Geometry::withinBounds(LocalCoords* coords) {
   double y = coords->getY();
   double z = coords->getZ();
 
+  /* Use the bounds cached by initializeFSRs() if possible */
+  if (_bounds_cached) {
+    if (x < _bounds[0] || x > _bounds[1] || y < _bounds[2] || y > _bounds[3]
+        || z < _bounds[4] || z > _bounds[5])
+      return false;
+    else
+      return true;
+  }
+
   if (x < getMinX() || x > getMaxX() || y < getMinY() || y > getMaxY()
       || z < getMinZ() || z > getMaxZ())
     return false;
@@ -1253,8 +1591,8 @@ bool Geometry::withinBounds(LocalCoords* coords) {
 
 /**
  * @brief Sets the centroid for an FSR
- * @details The _FSR_keys_map stores a hash of a std::string representing
- *          the Lattice/Cell/Universe hierarchy for a unique region
+ * @details The _FSR_keys_map stores a 128-bit hash of the
+ *          Lattice/Cell/Universe hierarchy for a unique region
  *          and the associated FSR data. _centroid is a point that represents
  *          the numerical centroid of an FSR computed using all segments
  *          contained in the FSR. This method is used by the TrackGenerator
@@ -1265,7 +1603,7 @@ bool Geometry::withinBounds(LocalCoords* coords) {
  * @param centroid a Point representing the FSR centroid
  */
 void Geometry::setFSRCentroid(int fsr, Point* centroid) {
-  _FSR_keys_map.at(_FSRs_to_keys[fsr])->_centroid = centroid;
+  getFSRData(fsr)->_centroid = centroid;
 }
 
 
@@ -1275,7 +1613,7 @@ void Geometry::setFSRCentroid(int fsr, Point* centroid) {
  */
 Cell* Geometry::findCellContainingFSR(int fsr_id) {
 
-  Point* point = _FSR_keys_map.at(_FSRs_to_keys[fsr_id])->_point;
+  Point* point = getFSRData(fsr_id)->_point;
   LocalCoords* coords = new LocalCoords(point->getX(), point->getY(),
                                         point->getZ());
   coords->setUniverse(_root_universe);
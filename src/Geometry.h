@@ -20,6 +20,7 @@
 #include <string>
 #include <omp.h>
 #include <functional>
+#include <stdint.h>
 #include "ParallelHashMap.h"
 #endif
 
@@ -66,6 +67,54 @@ struct fsr_data {
   }
 };
 
+/**
+ * @struct fsr_key
+ * @brief A fsr_key struct is a 128-bit hash of the hierarchical
+ *        lattice/universe/cell structure which uniquely identifies an FSR.
+ * @details The key is computed from the integer IDs and lattice cell
+ *          indices along the LocalCoords linked list without formatting
+ *          any strings. A human-readable key may be produced on demand
+ *          with Geometry::getFSRKeyString(...).
+ */
+struct fsr_key {
+
+  /** The first 64 bits of the hash */
+  uint64_t _hash1;
+
+  /** The second 64 bits of the hash */
+  uint64_t _hash2;
+
+  /** Constructor initializes the hash to zero */
+  fsr_key() {
+    _hash1 = 0;
+    _hash2 = 0;
+  }
+
+  /** Two keys are equal if all 128 bits of their hashes are equal */
+  bool operator==(const fsr_key& other) const {
+    return _hash1 == other._hash1 && _hash2 == other._hash2;
+  }
+};
+
+
+#ifndef SWIG
+namespace std {
+
+  /**
+   * @brief Hashes an fsr_key for a ParallelHashMap.
+   * @details The second half of the key is thoroughly mixed and is used
+   *          directly as the hash table index.
+   */
+  template <>
+  struct hash<fsr_key> {
+    size_t operator()(const fsr_key& key) const {
+      return key._hash2;
+    }
+  };
+}
+#endif
+
+
 void reset_auto_ids();
 
 
@@ -99,10 +148,17 @@ private:
   boundaryType _y_max_bc;
 
   /** An map of FSR key hashes to unique fsr_data structs */
-  ParallelHashMap<std::string, fsr_data*> _FSR_keys_map;
+  ParallelHashMap<fsr_key, fsr_data*> _FSR_keys_map;
 
   /** An vector of FSR key hashes indexed by FSR ID */
-  std::vector<std::string> _FSRs_to_keys;
+  std::vector<fsr_key> _FSRs_to_keys;
+
+  /** A read-only index of FSR IDs by FSR key built once the FSRs have all
+   *  been identified, which is searched without locks */
+  FrozenHashMap<fsr_key, int> _FSR_index;
+
+  /** An vector of pointers to the fsr_data structs indexed by FSR ID */
+  std::vector<fsr_data*> _FSRs_to_data;
 
   /* The Universe at the root node in the CSG tree */
   Universe* _root_universe;
@@ -113,8 +169,22 @@ private:
   /* A map of all Material in the Geometry for optimization purposes */
   std::map<int, Material*> _all_materials;
 
+  /** The min/max x, y and z of the root Universe cached for withinBounds() */
+  double _bounds[6];
+
+  /** Whether the bounds of the root Universe have been cached */
+  bool _bounds_cached;
+
+  /** The maximum number of levels in a LocalCoords linked list, or zero if
+   *  it has not been computed */
+  int _max_nesting_depth;
+
   Cell* findFirstCell(LocalCoords* coords);
   Cell* findNextCell(LocalCoords* coords);
+  fsr_data* getFSRData(int fsr_id);
+  int searchFSRId(LocalCoords* coords);
+  void locatePoints(double* points, int num_points, int num_dims,
+                    double zcoord, int* domains);
 
 public:
 
@@ -137,6 +207,7 @@ public:
   boundaryType getMaxYBoundaryType();
   Universe* getRootUniverse();
   int getNumFSRs();
+  int getMaxNestingDepth();
   int getNumEnergyGroups();
   int getNumMaterials();
   int getNumCells();
@@ -148,28 +219,33 @@ public:
   void setRootUniverse(Universe* root_universe);
 
   Cmfd* getCmfd();
-  std::vector<std::string>& getFSRsToKeys();
+  std::vector<fsr_key>& getFSRsToKeys();
   int getFSRId(LocalCoords* coords);
   Point* getFSRPoint(int fsr_id);
   Point* getFSRCentroid(int fsr_id);
-  std::string getFSRKey(LocalCoords* coords);
-  ParallelHashMap<std::string, fsr_data*>& getFSRKeysMap();
+  fsr_key getFSRKey(LocalCoords* coords);
+  std::string getFSRKeyString(LocalCoords* coords);
+  ParallelHashMap<fsr_key, fsr_data*>& getFSRKeysMap();
 
   /* Set parameters */
   void setCmfd(Cmfd* cmfd);
   void setFSRCentroid(int fsr, Point* centroid);
 
   /* Find methods */
-  Cell* findCellContainingCoords(LocalCoords* coords);
+  Cell* findCellContainingCoords(LocalCoords* coords, bool moved=false,
+                                 bool strict=false);
   Material* findFSRMaterial(int fsr_id);
   int findFSRId(LocalCoords* coords);
   Cell* findCellContainingFSR(int fsr_id);
+  void findDomainsAtPoints(double* points, int num_points, int num_dims,
+                           int* domains, int num_domains, double zcoord=0.0);
 
   /* Other worker methods */
   void subdivideCells();
   void initializeFSRs();
-  void segmentize(Track* track);
+  void segmentize(Track* track, LocalCoords* levels=NULL);
   void initializeFSRVectors();
+  void initializeFSRIndex();
   void computeFissionability(Universe* univ=NULL);
   std::vector<int> getSpatialDataOnGrid(std::vector<double> grid_x,
 					std::vector<double> grid_y,
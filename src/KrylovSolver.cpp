@@ -0,0 +1,1403 @@
+#include "KrylovSolver.h"
+#include <algorithm>
+#include <complex>
+#include <string>
+#include <vector>
+
+
+/**
+ * @brief Computes the eigenvalues of a real upper Hessenberg matrix with the
+ *        shifted QR algorithm.
+ * @details The matrix is stored row-major and is overwritten. Complex
+ *          conjugate eigenvalues are returned in adjacent entries.
+ * @param a the n x n upper Hessenberg matrix
+ * @param n the dimension of the matrix
+ * @param wr the real parts of the eigenvalues
+ * @param wi the imaginary parts of the eigenvalues
+ */
+static void hessenbergEigenvalues(double* a, int n, double* wr, double* wi) {
+
+/* Use one-based indices into the row-major matrix */
+#define a(i,j) (a[((i)-1)*n + (j)-1])
+#define wr(i) (wr[(i)-1])
+#define wi(i) (wi[(i)-1])
+
+  int nn, m, l, k, its, mmin;
+  double z, y, x, w, v, u, t, s, anorm;
+  double r = 0., q = 0., p = 0.;
+
+  anorm = 0.;
+  for (int i=1; i <= n; i++)
+    for (int j=std::max(i-1, 1); j <= n; j++)
+      anorm += fabs(a(i,j));
+
+  nn = n;
+  t = 0.;
+
+  while (nn >= 1) {
+    its = 0;
+
+    do {
+
+      /* Look for a single small subdiagonal element */
+      for (l=nn; l >= 2; l--) {
+        s = fabs(a(l-1,l-1)) + fabs(a(l,l));
+        if (s == 0.)
+          s = anorm;
+        if (fabs(a(l,l-1)) + s == s) {
+          a(l,l-1) = 0.;
+          break;
+        }
+      }
+
+      x = a(nn,nn);
+
+      /* One root found */
+      if (l == nn) {
+        wr(nn) = x + t;
+        wi(nn) = 0.;
+        nn--;
+      }
+      else {
+        y = a(nn-1,nn-1);
+        w = a(nn,nn-1) * a(nn-1,nn);
+
+        /* Two roots found */
+        if (l == nn-1) {
+          p = 0.5 * (y - x);
+          q = p * p + w;
+          z = sqrt(fabs(q));
+          x += t;
+
+          /* A real pair */
+          if (q >= 0.) {
+            z = p + (p >= 0. ? fabs(z) : -fabs(z));
+            wr(nn-1) = wr(nn) = x + z;
+            if (z != 0.)
+              wr(nn) = x - w / z;
+            wi(nn-1) = wi(nn) = 0.;
+          }
+
+          /* A complex pair */
+          else {
+            wr(nn-1) = wr(nn) = x + p;
+            wi(nn-1) = z;
+            wi(nn) = -z;
+          }
+          nn -= 2;
+        }
+
+        /* No roots found, so continue the iterations */
+        else {
+          if (its == 30 * n)
+            log_printf(ERROR, "Unable to compute the eigenvalues of the %d x "
+                       "%d Hessenberg matrix", n, n);
+
+          /* Use an exceptional shift */
+          if (its == 10 || its == 20) {
+            t += x;
+            for (int i=1; i <= nn; i++)
+              a(i,i) -= x;
+            s = fabs(a(nn,nn-1)) + fabs(a(nn-1,nn-2));
+            y = x = 0.75 * s;
+            w = -0.4375 * s * s;
+          }
+          its++;
+
+          /* Look for two consecutive small subdiagonal elements */
+          for (m=nn-2; m >= l; m--) {
+            z = a(m,m);
+            r = x - z;
+            s = y - z;
+            p = (r * s - w) / a(m+1,m) + a(m,m+1);
+            q = a(m+1,m+1) - z - r - s;
+            r = a(m+2,m+1);
+            s = fabs(p) + fabs(q) + fabs(r);
+            p /= s;
+            q /= s;
+            r /= s;
+            if (m == l)
+              break;
+            u = fabs(a(m,m-1)) * (fabs(q) + fabs(r));
+            v = fabs(p) * (fabs(a(m-1,m-1)) + fabs(z) + fabs(a(m+1,m+1)));
+            if (u + v == v)
+              break;
+          }
+
+          for (int i=m+2; i <= nn; i++) {
+            a(i,i-2) = 0.;
+            if (i != m+2)
+              a(i,i-3) = 0.;
+          }
+
+          /* Double shifted QR step on rows l to nn and columns m to nn */
+          for (k=m; k <= nn-1; k++) {
+            if (k != m) {
+              p = a(k,k-1);
+              q = a(k+1,k-1);
+              r = 0.;
+              if (k != nn-1)
+                r = a(k+2,k-1);
+              if ((x = fabs(p) + fabs(q) + fabs(r)) != 0.) {
+                p /= x;
+                q /= x;
+                r /= x;
+              }
+            }
+
+            s = sqrt(p * p + q * q + r * r);
+            if (p < 0.)
+              s = -s;
+
+            if (s != 0.) {
+              if (k == m) {
+                if (l != m)
+                  a(k,k-1) = -a(k,k-1);
+              }
+              else
+                a(k,k-1) = -s * x;
+
+              p += s;
+              x = p / s;
+              y = q / s;
+              z = r / s;
+              q /= p;
+              r /= p;
+
+              for (int j=k; j <= nn; j++) {
+                p = a(k,j) + q * a(k+1,j);
+                if (k != nn-1) {
+                  p += r * a(k+2,j);
+                  a(k+2,j) -= p * z;
+                }
+                a(k+1,j) -= p * y;
+                a(k,j) -= p * x;
+              }
+
+              mmin = nn < k+3 ? nn : k+3;
+              for (int i=l; i <= mmin; i++) {
+                p = x * a(i,k) + y * a(i,k+1);
+                if (k != nn-1) {
+                  p += z * a(i,k+2);
+                  a(i,k+2) -= p * r;
+                }
+                a(i,k+1) -= p * q;
+                a(i,k) -= p;
+              }
+            }
+          }
+        }
+      }
+    } while (l < nn-1);
+  }
+
+#undef a
+#undef wr
+#undef wi
+}
+
+
+/**
+ * @brief Computes the eigenvector of a real upper Hessenberg matrix for a
+ *        known eigenvalue with inverse iteration.
+ * @details The eigenvector is normalized to a unit 2-norm.
+ * @param H the n x n upper Hessenberg matrix stored row-major
+ * @param n the dimension of the matrix
+ * @param eigenvalue the (possibly complex) eigenvalue
+ * @param y the complex eigenvector
+ */
+static void hessenbergEigenvector(double* H, int n,
+                                  std::complex<double> eigenvalue,
+                                  std::complex<double>* y) {
+
+  std::vector< std::complex<double> > A(n * n);
+  std::vector<int> pivots(n);
+
+  double norm = 0.;
+  for (int i=0; i < n * n; i++)
+    norm = std::max(norm, fabs(H[i]));
+  double tiny = std::max(norm, 1.) * 1.E-14;
+
+  /* Perturb the eigenvalue so the shifted matrix is not exactly singular */
+  std::complex<double> shift = eigenvalue + tiny;
+
+  /* LU factorization of H - shift I with partial pivoting */
+  for (int i=0; i < n; i++) {
+    for (int j=0; j < n; j++)
+      A[i*n+j] = H[i*n+j];
+    A[i*n+i] -= shift;
+  }
+
+  for (int k=0; k < n; k++) {
+    int pivot = k;
+    for (int i=k+1; i < n; i++)
+      if (std::abs(A[i*n+k]) > std::abs(A[pivot*n+k]))
+        pivot = i;
+    pivots[k] = pivot;
+
+    if (pivot != k)
+      for (int j=0; j < n; j++)
+        std::swap(A[k*n+j], A[pivot*n+j]);
+
+    if (std::abs(A[k*n+k]) < tiny)
+      A[k*n+k] = tiny;
+
+    for (int i=k+1; i < n; i++) {
+      A[i*n+k] /= A[k*n+k];
+      for (int j=k+1; j < n; j++)
+        A[i*n+j] -= A[i*n+k] * A[k*n+j];
+    }
+  }
+
+  /* Two steps of inverse iteration from a flat vector */
+  for (int i=0; i < n; i++)
+    y[i] = 1.;
+
+  for (int iter=0; iter < 2; iter++) {
+
+    for (int k=0; k < n; k++)
+      if (pivots[k] != k)
+        std::swap(y[k], y[pivots[k]]);
+
+    for (int k=0; k < n; k++)
+      for (int i=k+1; i < n; i++)
+        y[i] -= A[i*n+k] * y[k];
+
+    for (int i=n-1; i >= 0; i--) {
+      for (int j=i+1; j < n; j++)
+        y[i] -= A[i*n+j] * y[j];
+      y[i] /= A[i*n+i];
+    }
+
+    norm = 0.;
+    for (int i=0; i < n; i++)
+      norm += std::norm(y[i]);
+    norm = sqrt(norm);
+    for (int i=0; i < n; i++)
+      y[i] /= norm;
+  }
+}
+
+
+/**
+ * @brief Computes the orthogonal factor Q of the QR factorization of a
+ *        square matrix with Householder reflections.
+ * @param P the n x n matrix stored row-major, which is overwritten with R
+ * @param n the dimension of the matrix
+ * @param Q the n x n orthogonal matrix stored row-major
+ */
+static void householderQ(double* P, int n, double* Q) {
+
+  std::vector<double> v(n);
+
+  for (int i=0; i < n; i++)
+    for (int j=0; j < n; j++)
+      Q[i*n+j] = (i == j) ? 1. : 0.;
+
+  for (int k=0; k < n-1; k++) {
+
+    /* Compute the Householder vector for column k */
+    double norm = 0.;
+    for (int i=k; i < n; i++)
+      norm += P[i*n+k] * P[i*n+k];
+    norm = sqrt(norm);
+
+    if (norm == 0.)
+      continue;
+
+    for (int i=k; i < n; i++)
+      v[i] = P[i*n+k];
+    v[k] += (v[k] >= 0.) ? norm : -norm;
+
+    double v_norm = 0.;
+    for (int i=k; i < n; i++)
+      v_norm += v[i] * v[i];
+
+    /* Apply the reflection to the rows of P and the columns of Q */
+    for (int j=0; j < n; j++) {
+      double dot = 0.;
+      for (int i=k; i < n; i++)
+        dot += v[i] * P[i*n+j];
+      dot *= 2. / v_norm;
+      for (int i=k; i < n; i++)
+        P[i*n+j] -= dot * v[i];
+    }
+
+    for (int i=0; i < n; i++) {
+      double dot = 0.;
+      for (int j=k; j < n; j++)
+        dot += Q[i*n+j] * v[j];
+      dot *= 2. / v_norm;
+      for (int j=k; j < n; j++)
+        Q[i*n+j] -= dot * v[j];
+    }
+  }
+}
+
+
+/**
+ * @brief Constructor initializes an empty KrylovSolver for a Solver.
+ * @param solver the Solver used to apply the transport operators
+ */
+KrylovSolver::KrylovSolver(Solver* solver) {
+
+  if (solver == NULL)
+    log_printf(ERROR, "Unable to create a KrylovSolver without a Solver");
+
+  _solver = solver;
+  _num_groups = 0;
+  _size = 0;
+  _num_modes = 5;
+  _subspace_size = 0;
+  _gmres_restart = 20;
+  _max_inner_iters = 1000;
+  _max_outer_iters = 300;
+  _inner_tol = 1.E-6;
+  _outer_tol = 1.E-5;
+  _num_scatter_sweeps = 0;
+  _num_fission_sweeps = 0;
+  _num_total_sweeps = 0;
+  _num_converged = 0;
+
+  _eigenvalues_real = NULL;
+  _eigenvalues_imag = NULL;
+  _eigenvectors = NULL;
+  _saved_fixed_sources = NULL;
+
+  _timer = new Timer();
+}
+
+
+/**
+ * @brief Destructor deletes the eigenmodes and the timer.
+ */
+KrylovSolver::~KrylovSolver() {
+  clearEigenmodes();
+  delete _timer;
+}
+
+
+/**
+ * @brief Returns the number of eigenmodes to compute.
+ * @return the number of eigenmodes
+ */
+int KrylovSolver::getNumModes() {
+  return _num_modes;
+}
+
+
+/**
+ * @brief Returns the number of eigenmodes which converged in the last
+ *        call to computeEigenmodes().
+ * @return the number of converged eigenmodes
+ */
+int KrylovSolver::getNumConvergedModes() {
+  return _num_converged;
+}
+
+
+/**
+ * @brief Returns the maximum dimension of the Arnoldi subspace.
+ * @details The default of 0 uses max(2 x # modes + 1, 20) vectors.
+ * @return the dimension of the Arnoldi subspace
+ */
+int KrylovSolver::getSubspaceSize() {
+  return _subspace_size;
+}
+
+
+/**
+ * @brief Returns the number of GMRES iterations between restarts.
+ * @return the GMRES restart length
+ */
+int KrylovSolver::getGMRESRestart() {
+  return _gmres_restart;
+}
+
+
+/**
+ * @brief Returns the relative residual tolerance for the GMRES solves.
+ * @return the inner tolerance
+ */
+double KrylovSolver::getInnerTolerance() {
+  return _inner_tol;
+}
+
+
+/**
+ * @brief Returns the relative residual tolerance for the eigenpairs.
+ * @return the outer tolerance
+ */
+double KrylovSolver::getOuterTolerance() {
+  return _outer_tol;
+}
+
+
+/**
+ * @brief Returns the number of transport sweeps with the scattering source
+ *        in the last solve.
+ * @return the number of scattering source transport sweeps
+ */
+int KrylovSolver::getNumScatterSweeps() {
+  return _num_scatter_sweeps;
+}
+
+
+/**
+ * @brief Returns the number of transport sweeps with the fission source
+ *        in the last solve.
+ * @return the number of fission source transport sweeps
+ */
+int KrylovSolver::getNumFissionSweeps() {
+  return _num_fission_sweeps;
+}
+
+
+/**
+ * @brief Returns the number of transport sweeps with the total source
+ *        in the last solve.
+ * @return the number of total source transport sweeps
+ */
+int KrylovSolver::getNumTotalSweeps() {
+  return _num_total_sweeps;
+}
+
+
+/**
+ * @brief Returns the real part of an eigenvalue.
+ * @details The eigenvalues are sorted by decreasing magnitude such that
+ *          mode 0 is the fundamental mode.
+ * @param mode the index of the eigenmode
+ * @return the real part of the eigenvalue
+ */
+double KrylovSolver::getEigenvalue(int mode) {
+
+  if (_eigenvalues_real == NULL)
+    log_printf(ERROR, "Unable to return an eigenvalue since the eigenmodes "
+               "have not yet been computed");
+
+  else if (mode < 0 || mode >= _num_modes)
+    log_printf(ERROR, "Unable to return eigenvalue %d since only %d "
+               "eigenmodes were computed", mode, _num_modes);
+
+  return _eigenvalues_real[mode];
+}
+
+
+/**
+ * @brief Returns the imaginary part of an eigenvalue.
+ * @param mode the index of the eigenmode
+ * @return the imaginary part of the eigenvalue
+ */
+double KrylovSolver::getEigenvalueImag(int mode) {
+
+  if (_eigenvalues_imag == NULL)
+    log_printf(ERROR, "Unable to return an eigenvalue since the eigenmodes "
+               "have not yet been computed");
+
+  else if (mode < 0 || mode >= _num_modes)
+    log_printf(ERROR, "Unable to return eigenvalue %d since only %d "
+               "eigenmodes were computed", mode, _num_modes);
+
+  return _eigenvalues_imag[mode];
+}
+
+
+/**
+ * @brief Copies the real part of an eigenvector into an array.
+ * @details The eigenvectors are normalized to a unit 2-norm. This method may
+ *          be called from Python to retrieve an eigenvector as a NumPy
+ *          array as follows:
+ *
+ * @code
+ *          num_fluxes = geometry.getNumFSRs() * geometry.getNumEnergyGroups()
+ *          eigenvector = krylov_solver.getEigenvector(mode, num_fluxes)
+ * @endcode
+ *
+ * @param mode the index of the eigenmode
+ * @param eigenvector an array of FSR scalar fluxes in each energy group
+ * @param num_fluxes the total number of FSR flux values
+ */
+void KrylovSolver::getEigenvector(int mode, double* eigenvector,
+                                  int num_fluxes) {
+
+  if (_eigenvectors == NULL)
+    log_printf(ERROR, "Unable to return an eigenvector since the eigenmodes "
+               "have not yet been computed");
+
+  else if (mode < 0 || mode >= _num_modes)
+    log_printf(ERROR, "Unable to return eigenvector %d since only %d "
+               "eigenmodes were computed", mode, _num_modes);
+
+  else if (num_fluxes != _size)
+    log_printf(ERROR, "Unable to return eigenvector %d with %d flux values "
+               "since it has %ld values", mode, num_fluxes, _size);
+
+  double* source = &_eigenvectors[mode * _size];
+
+#pragma omp parallel for schedule(static)
+  for (long i=0; i < _size; i++)
+    eigenvector[i] = source[i];
+}
+
+
+/**
+ * @brief Sets the number of eigenmodes to compute.
+ * @param num_modes the number of eigenmodes (> 0)
+ */
+void KrylovSolver::setNumModes(int num_modes) {
+
+  if (num_modes <= 0)
+    log_printf(ERROR, "Unable to set the number of eigenmodes to %d since it "
+               "is not a positive integer", num_modes);
+
+  _num_modes = num_modes;
+}
+
+
+/**
+ * @brief Sets the maximum dimension of the Arnoldi subspace.
+ * @details The subspace must hold at least two more vectors than the number
+ *          of eigenmodes. A value of 0 uses max(2 x # modes + 1, 20) vectors.
+ * @param subspace_size the dimension of the Arnoldi subspace
+ */
+void KrylovSolver::setSubspaceSize(int subspace_size) {
+
+  if (subspace_size < 0)
+    log_printf(ERROR, "Unable to set the Arnoldi subspace size to %d since "
+               "it is negative", subspace_size);
+
+  _subspace_size = subspace_size;
+}
+
+
+/**
+ * @brief Sets the number of GMRES iterations between restarts.
+ * @param restart the GMRES restart length (> 0)
+ */
+void KrylovSolver::setGMRESRestart(int restart) {
+
+  if (restart <= 0)
+    log_printf(ERROR, "Unable to set the GMRES restart length to %d since it "
+               "is not a positive integer", restart);
+
+  _gmres_restart = restart;
+}
+
+
+/**
+ * @brief Sets the maximum number of GMRES iterations for each linear solve.
+ * @param max_iters the maximum number of GMRES iterations (> 0)
+ */
+void KrylovSolver::setMaxInnerIterations(int max_iters) {
+
+  if (max_iters <= 0)
+    log_printf(ERROR, "Unable to set the maximum number of GMRES iterations "
+               "to %d since it is not a positive integer", max_iters);
+
+  _max_inner_iters = max_iters;
+}
+
+
+/**
+ * @brief Sets the maximum number of implicit restarts of the Arnoldi method.
+ * @param max_iters the maximum number of Arnoldi restarts (> 0)
+ */
+void KrylovSolver::setMaxOuterIterations(int max_iters) {
+
+  if (max_iters <= 0)
+    log_printf(ERROR, "Unable to set the maximum number of Arnoldi restarts "
+               "to %d since it is not a positive integer", max_iters);
+
+  _max_outer_iters = max_iters;
+}
+
+
+/**
+ * @brief Sets the relative residual tolerance for the GMRES solves.
+ * @param tolerance the inner tolerance (> 0)
+ */
+void KrylovSolver::setInnerTolerance(double tolerance) {
+
+  if (tolerance <= 0.)
+    log_printf(ERROR, "Unable to set the inner tolerance to %f since it is "
+               "not a positive number", tolerance);
+
+  _inner_tol = tolerance;
+}
+
+
+/**
+ * @brief Sets the relative residual tolerance for the Ritz eigenpairs.
+ * @param tolerance the outer tolerance (> 0)
+ */
+void KrylovSolver::setOuterTolerance(double tolerance) {
+
+  if (tolerance <= 0.)
+    log_printf(ERROR, "Unable to set the outer tolerance to %f since it is "
+               "not a positive number", tolerance);
+
+  _outer_tol = tolerance;
+}
+
+
+/**
+ * @brief Initializes the Solver's data structures for transport sweeps.
+ * @param mode the solution type (FORWARD or ADJOINT)
+ */
+void KrylovSolver::initializeSolver(solverMode mode) {
+
+  if (_solver->_track_generator == NULL)
+    log_printf(ERROR, "The KrylovSolver is unable to sweep the Tracks "
+               "since the Solver does not contain a TrackGenerator");
+
+  if (_solver->_cmfd != NULL && _solver->_cmfd->isFluxUpdateOn())
+    log_printf(ERROR, "The KrylovSolver is unable to sweep the Tracks "
+               "with CMFD acceleration");
+
+  checkBoundaryConditions();
+
+  _solver->initializeFSRs();
+  _solver->initializeMaterials(mode);
+  _solver->countFissionableFSRs();
+  _solver->initializeExpEvaluator();
+  _solver->initializeFluxArrays();
+  _solver->initializeSourceArrays();
+  _solver->zeroTrackFluxes();
+
+  if (_solver->_scalar_flux == NULL)
+    log_printf(ERROR, "The KrylovSolver is unable to sweep the Tracks "
+               "since the Solver does not store its fluxes on the host");
+
+  _num_groups = _solver->getGeometry()->getNumEnergyGroups();
+  _size = (long) _solver->_num_FSRs * _num_groups;
+  _num_scatter_sweeps = 0;
+  _num_fission_sweeps = 0;
+  _num_total_sweeps = 0;
+}
+
+
+/**
+ * @brief Checks that the Geometry has vacuum boundary conditions.
+ * @details Incoming angular fluxes make each transport sweep depend on the
+ *          previous sweep, such that the operators are only linear in the
+ *          scalar flux with vacuum boundary conditions.
+ */
+void KrylovSolver::checkBoundaryConditions() {
+
+  Geometry* geometry = _solver->getGeometry();
+
+  if (geometry->getMinXBoundaryType() != VACUUM ||
+      geometry->getMaxXBoundaryType() != VACUUM ||
+      geometry->getMinYBoundaryType() != VACUUM ||
+      geometry->getMaxYBoundaryType() != VACUUM)
+    log_printf(ERROR, "All boundary conditions must be VACUUM for the "
+               "KrylovSolver");
+}
+
+
+/**
+ * @brief Deletes the eigenvalues and eigenvectors.
+ */
+void KrylovSolver::clearEigenmodes() {
+
+  if (_eigenvalues_real != NULL)
+    delete [] _eigenvalues_real;
+
+  if (_eigenvalues_imag != NULL)
+    delete [] _eigenvalues_imag;
+
+  if (_eigenvectors != NULL)
+    delete [] _eigenvectors;
+
+  _eigenvalues_real = NULL;
+  _eigenvalues_imag = NULL;
+  _eigenvectors = NULL;
+  _num_converged = 0;
+}
+
+
+/**
+ * @brief Copies a Krylov vector into the Solver's FSR scalar fluxes.
+ * @details The fluxes in any groups padded by the VectorizedSolver are zeroed.
+ * @param x the Krylov vector
+ */
+void KrylovSolver::loadFluxes(double* x) {
+
+  FP_PRECISION* scalar_flux = _solver->_scalar_flux;
+  int num_groups = _solver->_num_groups;
+
+#pragma omp parallel for schedule(static)
+  for (long r=0; r < _solver->_num_FSRs; r++) {
+    for (int e=0; e < _num_groups; e++)
+      scalar_flux[r*num_groups+e] = x[r*_num_groups+e];
+    for (int e=_num_groups; e < num_groups; e++)
+      scalar_flux[r*num_groups+e] = 0.;
+  }
+}
+
+
+/**
+ * @brief Copies the Solver's FSR scalar fluxes into a Krylov vector.
+ * @details The fluxes in any groups padded by the VectorizedSolver are
+ *          skipped.
+ * @param x the Krylov vector
+ */
+void KrylovSolver::retrieveFluxes(double* x) {
+
+  FP_PRECISION* scalar_flux = _solver->_scalar_flux;
+  int num_groups = _solver->_num_groups;
+
+#pragma omp parallel for schedule(static)
+  for (long r=0; r < _solver->_num_FSRs; r++) {
+    for (int e=0; e < _num_groups; e++)
+      x[r*_num_groups+e] = scalar_flux[r*num_groups+e];
+  }
+}
+
+
+/**
+ * @brief Applies one of the operators inverted by GMRES to a vector.
+ * @details The scattering operator is (I - TS) and the transport operator is
+ *          (I - T(S + F/k)), where T is a transport sweep without any fixed
+ *          or incoming boundary sources.
+ * @param op the operator to apply
+ * @param x the vector to which the operator is applied
+ * @param y the result of the operator applied to x
+ */
+void KrylovSolver::applyOperator(krylovOperator op, double* x, double* y) {
+
+  loadFluxes(x);
+
+  if (op == SCATTER_OPERATOR) {
+    _solver->scatterTransportSweep();
+    _num_scatter_sweeps++;
+  }
+  else {
+    _solver->computeFSRSources();
+    _solver->transportSweep();
+    _solver->addSourceToScalarFlux();
+    _num_total_sweeps++;
+  }
+
+  retrieveFluxes(y);
+
+#pragma omp parallel for schedule(static)
+  for (long i=0; i < _size; i++)
+    y[i] = x[i] - y[i];
+}
+
+
+/**
+ * @brief Applies the fission operator TF to a vector.
+ * @param x the vector to which the operator is applied
+ * @param y the result of the operator applied to x
+ */
+void KrylovSolver::applyFissionOperator(double* x, double* y) {
+
+  loadFluxes(x);
+  _solver->fissionTransportSweep();
+  _num_fission_sweeps++;
+
+  retrieveFluxes(y);
+}
+
+
+/**
+ * @brief Applies the eigenvalue operator (I - TS)^-1 TF to a vector.
+ * @details The scattering operator is inverted with GMRES.
+ * @param x the vector to which the operator is applied
+ * @param y the result of the operator applied to x
+ */
+void KrylovSolver::applyEigenOperator(double* x, double* y) {
+
+  double* fission_flux = new double[_size];
+
+  applyFissionOperator(x, fission_flux);
+
+#pragma omp parallel for schedule(static)
+  for (long i=0; i < _size; i++)
+    y[i] = 0.;
+
+  solveGMRES(SCATTER_OPERATOR, y, fission_flux, false);
+
+  delete [] fission_flux;
+}
+
+
+/**
+ * @brief Computes the dot product of two Krylov vectors.
+ * @param x the first vector
+ * @param y the second vector
+ * @return the dot product
+ */
+double KrylovSolver::dotProduct(double* x, double* y) {
+
+  double dot = 0.;
+
+#pragma omp parallel for schedule(static) reduction(+:dot)
+  for (long i=0; i < _size; i++)
+    dot += x[i] * y[i];
+
+  return dot;
+}
+
+
+/**
+ * @brief Orthogonalizes a vector against an orthonormal basis.
+ * @details Modified Gram-Schmidt is applied twice to retain orthogonality
+ *          in large Krylov subspaces.
+ * @param basis the orthonormal basis vectors, stored contiguously
+ * @param num_vectors the number of basis vectors
+ * @param w the vector to orthogonalize
+ * @param h the projections of w onto each basis vector
+ */
+void KrylovSolver::orthogonalize(double* basis, int num_vectors, double* w,
+                                 double* h) {
+
+  for (int j=0; j < num_vectors; j++)
+    h[j] = 0.;
+
+  for (int pass=0; pass < 2; pass++) {
+    for (int j=0; j < num_vectors; j++) {
+      double* v = &basis[j * _size];
+      double proj = dotProduct(v, w);
+      h[j] += proj;
+
+#pragma omp parallel for schedule(static)
+      for (long i=0; i < _size; i++)
+        w[i] -= proj * v[i];
+    }
+  }
+}
+
+
+/**
+ * @brief Solves a linear system with restarted GMRES.
+ * @details The solution is computed matrix-free with one transport sweep for
+ *          each GMRES iteration, and is converged to a relative residual of
+ *          the inner tolerance.
+ * @param op the operator to invert
+ * @param x the initial guess, which is overwritten with the solution
+ * @param b the right hand side
+ * @param verbose whether to report the residual of each iteration
+ * @return the number of GMRES iterations
+ */
+int KrylovSolver::solveGMRES(krylovOperator op, double* x, double* b,
+                             bool verbose) {
+
+  int m = _gmres_restart;
+  double* V = new double[(m+1) * _size];
+  std::vector<double> H((m+1) * m);
+  std::vector<double> h(m+1);
+  std::vector<double> cs(m), sn(m), g(m+1), y(m);
+
+  double b_norm = sqrt(dotProduct(b, b));
+  double residual = 0.;
+  int iters = 0;
+
+  if (b_norm == 0.) {
+#pragma omp parallel for schedule(static)
+    for (long i=0; i < _size; i++)
+      x[i] = 0.;
+    delete [] V;
+    return 0;
+  }
+
+  /* A zero initial guess has the right hand side as its residual */
+  bool zero_guess = (dotProduct(x, x) == 0.);
+
+  while (true) {
+
+    /* Compute the initial residual of this restart cycle */
+    if (zero_guess) {
+#pragma omp parallel for schedule(static)
+      for (long i=0; i < _size; i++)
+        V[i] = b[i];
+      zero_guess = false;
+    }
+    else {
+      applyOperator(op, x, V);
+#pragma omp parallel for schedule(static)
+      for (long i=0; i < _size; i++)
+        V[i] = b[i] - V[i];
+    }
+
+    double beta = sqrt(dotProduct(V, V));
+    residual = beta / b_norm;
+
+    if (residual < _inner_tol || iters >= _max_inner_iters)
+      break;
+
+#pragma omp parallel for schedule(static)
+    for (long i=0; i < _size; i++)
+      V[i] /= beta;
+
+    std::fill(g.begin(), g.end(), 0.);
+    g[0] = beta;
+
+    /* Arnoldi iterations with Givens rotations of the Hessenberg matrix */
+    int j;
+    for (j=0; j < m && iters < _max_inner_iters; j++) {
+
+      double* w = &V[(j+1) * _size];
+      applyOperator(op, &V[j * _size], w);
+      iters++;
+
+      orthogonalize(V, j+1, w, &h[0]);
+      h[j+1] = sqrt(dotProduct(w, w));
+
+      if (h[j+1] > 0.) {
+#pragma omp parallel for schedule(static)
+        for (long i=0; i < _size; i++)
+          w[i] /= h[j+1];
+      }
+
+      for (int k=0; k < j; k++) {
+        double temp = cs[k] * h[k] + sn[k] * h[k+1];
+        h[k+1] = -sn[k] * h[k] + cs[k] * h[k+1];
+        h[k] = temp;
+      }
+
+      double denom = sqrt(h[j] * h[j] + h[j+1] * h[j+1]);
+      cs[j] = h[j] / denom;
+      sn[j] = h[j+1] / denom;
+      h[j] = denom;
+      h[j+1] = 0.;
+
+      g[j+1] = -sn[j] * g[j];
+      g[j] = cs[j] * g[j];
+
+      for (int k=0; k <= j; k++)
+        H[k*m + j] = h[k];
+
+      residual = fabs(g[j+1]) / b_norm;
+
+      if (verbose)
+        log_printf(NORMAL, "Iteration %d:\tres = %1.3E", iters, residual);
+      else
+        log_printf(DEBUG, "GMRES iteration %d:\tres = %1.3E", iters,
+                   residual);
+
+      if (residual < _inner_tol) {
+        j++;
+        break;
+      }
+    }
+
+    /* Update the solution with the least squares solution for this cycle */
+    for (int k=j-1; k >= 0; k--) {
+      y[k] = g[k];
+      for (int l=k+1; l < j; l++)
+        y[k] -= H[k*m + l] * y[l];
+      y[k] /= H[k*m + k];
+    }
+
+#pragma omp parallel for schedule(static)
+    for (long i=0; i < _size; i++) {
+      for (int k=0; k < j; k++)
+        x[i] += y[k] * V[k * _size + i];
+    }
+
+    if (residual < _inner_tol || iters >= _max_inner_iters)
+      break;
+  }
+
+  if (residual >= _inner_tol)
+    log_printf(WARNING, "Unable to converge GMRES in %d iterations with "
+               "res = %1.3E", iters, residual);
+  else
+    log_printf(INFO, "Converged GMRES in %d iterations", iters);
+
+  delete [] V;
+  return iters;
+}
+
+
+/**
+ * @brief Computes the eigenmodes of the k-eigenvalue problem with the
+ *        implicitly restarted Arnoldi method.
+ * @details The eigenmodes with the largest eigenvalues of the operator
+ *          (I - TS)^-1 TF are computed, where each application of the
+ *          inverse of the scattering operator is a GMRES solve. The
+ *          fundamental eigenvalue and eigenvector are stored in the Solver
+ *          as its eigenvalue and FSR scalar fluxes. This method may be
+ *          called from Python as follows:
+ *
+ * @code
+ *          krylov_solver = openmoc.KrylovSolver(solver)
+ *          krylov_solver.setNumModes(5)
+ *          krylov_solver.computeEigenmodes()
+ * @endcode
+ *
+ * @param mode the solution type (FORWARD or ADJOINT)
+ */
+void KrylovSolver::computeEigenmodes(solverMode mode) {
+
+  log_printf(NORMAL, "Computing the eigenmodes...");
+
+  _timer->clearSplits();
+  _timer->startTimer();
+
+  initializeSolver(mode);
+  clearEigenmodes();
+
+  int nev = _num_modes;
+  int m = _subspace_size;
+  if (m == 0)
+    m = std::max(2 * nev + 1, 20);
+  if (m > _size)
+    m = _size;
+
+  if (m < nev + 2)
+    log_printf(ERROR, "Unable to compute %d eigenmodes with an Arnoldi "
+               "subspace of %d vectors", nev, m);
+
+  /* The Arnoldi basis and the (m+1) x m Hessenberg matrix */
+  double* V = new double[(m+1) * _size];
+  std::vector<double> H((m+1) * m, 0.);
+  std::vector<double> h(m+1);
+
+  std::vector<double> work(m * m), Q(m * m), P(m * m), T(m * m);
+  std::vector<double> wr(m), wi(m), residuals(nev);
+  std::vector<int> order(m);
+  std::vector< std::complex<double> > ritz_vectors(nev * m);
+
+  /* Start from a perturbed flat flux such that the starting vector is not
+   * orthogonal to eigenmodes without the symmetry of the Geometry */
+#pragma omp parallel for schedule(static)
+  for (long i=0; i < _size; i++)
+    V[i] = 1. + 0.5 * sin((double) i);
+
+  double norm = 1. / sqrt(dotProduct(V, V));
+#pragma omp parallel for schedule(static)
+  for (long i=0; i < _size; i++)
+    V[i] *= norm;
+
+  int k = 0;
+  int restart;
+
+  for (restart=0; restart < _max_outer_iters; restart++) {
+
+    /* Extend the Arnoldi factorization from k to m vectors */
+    for (int j=k; j < m; j++) {
+      double* w = &V[(j+1) * _size];
+      applyEigenOperator(&V[j * _size], w);
+      orthogonalize(V, j+1, w, &h[0]);
+      h[j+1] = sqrt(dotProduct(w, w));
+
+      for (int i=0; i <= j+1; i++)
+        H[i*m + j] = h[i];
+
+      if (h[j+1] > 0.) {
+#pragma omp parallel for schedule(static)
+        for (long i=0; i < _size; i++)
+          w[i] /= h[j+1];
+      }
+    }
+
+    double beta = H[m*m + m-1];
+
+    /* Compute the Ritz values sorted by decreasing magnitude */
+    std::copy(H.begin(), H.begin() + m*m, work.begin());
+    hessenbergEigenvalues(&work[0], m, &wr[0], &wi[0]);
+
+    for (int i=0; i < m; i++)
+      order[i] = i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+      double mag_a = wr[a] * wr[a] + wi[a] * wi[a];
+      double mag_b = wr[b] * wr[b] + wi[b] * wi[b];
+      if (mag_a != mag_b)
+        return mag_a > mag_b;
+      return wi[a] > wi[b];
+    });
+
+    std::vector<double> sorted_wr(m), sorted_wi(m);
+    for (int i=0; i < m; i++) {
+      sorted_wr[i] = wr[order[i]];
+      sorted_wi[i] = wi[order[i]];
+    }
+    wr = sorted_wr;
+    wi = sorted_wi;
+
+    /* Estimate the residual of each wanted Ritz pair */
+    _num_converged = 0;
+    double max_residual = 0.;
+
+    for (int i=0; i < nev; i++) {
+      std::complex<double> eigenvalue(wr[i], wi[i]);
+      hessenbergEigenvector(&H[0], m, eigenvalue, &ritz_vectors[i*m]);
+      residuals[i] = fabs(beta) * std::abs(ritz_vectors[i*m + m-1]) /
+                     std::max(std::abs(eigenvalue), 1.E-30);
+      max_residual = std::max(max_residual, residuals[i]);
+      if (residuals[i] < _outer_tol)
+        _num_converged++;
+    }
+
+    log_printf(NORMAL, "Arnoldi restart %d:\tk_eff = %1.6f\t%d of %d modes "
+               "converged\tres = %1.3E", restart, wr[0], _num_converged,
+               nev, max_residual);
+
+    if (_num_converged == nev)
+      break;
+
+    /* Keep both eigenvalues of a complex pair in the wanted set */
+    k = nev;
+    if (wi[k-1] > 0.)
+      k++;
+    if (k >= m)
+      log_printf(ERROR, "Unable to restart the Arnoldi method with %d "
+                 "eigenmodes in a subspace of %d vectors", nev, m);
+
+    /* Apply the unwanted Ritz values as exact shifts to the Hessenberg
+     * matrix, with double shifts for complex conjugate pairs */
+    std::fill(Q.begin(), Q.end(), 0.);
+    for (int i=0; i < m; i++)
+      Q[i*m + i] = 1.;
+
+    for (int s=k; s < m; s++) {
+
+      for (int i=0; i < m; i++)
+        for (int j=0; j < m; j++)
+          P[i*m + j] = H[i*m + j];
+
+      if (wi[s] == 0.) {
+        for (int i=0; i < m; i++)
+          P[i*m + i] -= wr[s];
+      }
+      else {
+        double trace = 2. * wr[s];
+        double det = wr[s] * wr[s] + wi[s] * wi[s];
+        for (int i=0; i < m; i++) {
+          for (int j=0; j < m; j++) {
+            double sum = 0.;
+            for (int l=0; l < m; l++)
+              sum += H[i*m + l] * H[l*m + j];
+            T[i*m + j] = sum - trace * H[i*m + j];
+          }
+          T[i*m + i] += det;
+        }
+        P = T;
+        s++;
+      }
+
+      householderQ(&P[0], m, &work[0]);
+
+      /* H = Q^T H Q */
+      for (int i=0; i < m; i++) {
+        for (int j=0; j < m; j++) {
+          double sum = 0.;
+          for (int l=0; l < m; l++)
+            sum += H[i*m + l] * work[l*m + j];
+          T[i*m + j] = sum;
+        }
+      }
+      for (int i=0; i < m; i++) {
+        for (int j=0; j < m; j++) {
+          double sum = 0.;
+          for (int l=0; l < m; l++)
+            sum += work[l*m + i] * T[l*m + j];
+          H[i*m + j] = (i > j + 1) ? 0. : sum;
+        }
+      }
+
+      /* Accumulate the shifts */
+      for (int i=0; i < m; i++) {
+        for (int j=0; j < m; j++) {
+          double sum = 0.;
+          for (int l=0; l < m; l++)
+            sum += Q[i*m + l] * work[l*m + j];
+          T[i*m + j] = sum;
+        }
+      }
+      Q = T;
+    }
+
+    /* Compress the basis to k + 1 vectors with the accumulated shifts */
+    double sigma = Q[(m-1)*m + k-1];
+    double h_k = H[k*m + k-1];
+
+#pragma omp parallel
+    {
+      std::vector<double> row(k+1);
+
+#pragma omp for schedule(static)
+      for (long i=0; i < _size; i++) {
+        for (int j=0; j <= k; j++) {
+          row[j] = 0.;
+          for (int l=0; l < m; l++)
+            row[j] += V[l * _size + i] * Q[l*m + j];
+        }
+        row[k] = h_k * row[k] + beta * sigma * V[m * _size + i];
+        for (int j=0; j <= k; j++)
+          V[j * _size + i] = row[j];
+      }
+    }
+
+    /* Normalize the new residual vector */
+    double* f = &V[k * _size];
+    double f_norm = sqrt(dotProduct(f, f));
+    if (f_norm > 0.) {
+#pragma omp parallel for schedule(static)
+      for (long i=0; i < _size; i++)
+        f[i] /= f_norm;
+    }
+
+    for (int i=k; i <= m; i++)
+      for (int j=0; j < m; j++)
+        H[i*m + j] = 0.;
+    for (int i=0; i < k; i++)
+      for (int j=k; j < m; j++)
+        H[i*m + j] = 0.;
+    H[k*m + k-1] = f_norm;
+  }
+
+  if (_num_converged < nev)
+    log_printf(WARNING, "Unable to converge %d of %d eigenmodes in %d "
+               "Arnoldi restarts", nev - _num_converged, nev, restart);
+
+  /* Compute the eigenvectors from the Ritz vectors */
+  _eigenvalues_real = new double[nev];
+  _eigenvalues_imag = new double[nev];
+  _eigenvectors = new double[nev * _size];
+
+  for (int n=0; n < nev; n++) {
+    _eigenvalues_real[n] = wr[n];
+    _eigenvalues_imag[n] = wi[n];
+
+    double* eigenvector = &_eigenvectors[n * _size];
+    std::complex<double>* y = &ritz_vectors[n*m];
+
+#pragma omp parallel for schedule(static)
+    for (long i=0; i < _size; i++) {
+      double sum = 0.;
+      for (int j=0; j < m; j++)
+        sum += V[j * _size + i] * y[j].real();
+      eigenvector[i] = sum;
+    }
+
+    /* Normalize each eigenvector with a positive sum */
+    double sum = 0.;
+#pragma omp parallel for schedule(static) reduction(+:sum)
+    for (long i=0; i < _size; i++)
+      sum += eigenvector[i];
+
+    norm = sqrt(dotProduct(eigenvector, eigenvector));
+    if (sum < 0.)
+      norm = -norm;
+
+#pragma omp parallel for schedule(static)
+    for (long i=0; i < _size; i++)
+      eigenvector[i] /= norm;
+  }
+
+  delete [] V;
+
+  /* Store the fundamental mode in the Solver */
+  _solver->_k_eff = _eigenvalues_real[0];
+  loadFluxes(_eigenvectors);
+  _solver->resetMaterials(mode);
+
+  _timer->stopTimer();
+  _timer->recordSplit("Total time");
+
+  double tot_time = _timer->getTime();
+  std::string msg_string = "Total time to solution";
+  msg_string.resize(REPORT_WIDTH, '.');
+  log_printf(RESULT, "%s%1.4E sec", msg_string.c_str(), tot_time);
+
+  msg_string = "Solution time per mode";
+  msg_string.resize(REPORT_WIDTH, '.');
+  log_printf(RESULT, "%s%1.4E sec", msg_string.c_str(), tot_time / nev);
+
+  log_printf(NORMAL, "Computed %d eigenmodes with %d scattering and %d "
+             "fission transport sweeps", nev, _num_scatter_sweeps,
+             _num_fission_sweeps);
+}
+
+
+/**
+ * @brief Computes the scalar flux for the fixed sources with GMRES.
+ * @details The flux solves (I - T(S + F/k)) phi = T q, where T q is the
+ *          uncollided flux from the fixed sources q. This converges in fewer
+ *          transport sweeps than the source iterations of
+ *          Solver::computeFlux() for optically thick, highly scattering
+ *          problems. The flux is stored in the Solver. This method may be
+ *          called from Python as follows:
+ *
+ * @code
+ *          // Assign fixed sources
+ *          // ...
+ *
+ *          krylov_solver = openmoc.KrylovSolver(solver)
+ *          krylov_solver.computeFlux(k_eff=0.981)
+ * @endcode
+ *
+ * @param mode the solution type (FORWARD or ADJOINT)
+ * @param k_eff the sub/super-critical eigenvalue (default 1.0)
+ */
+void KrylovSolver::computeFlux(solverMode mode, double k_eff) {
+
+  if (k_eff <= 0.)
+    log_printf(ERROR, "The KrylovSolver is unable to compute the flux with "
+               "keff = %f since it is not a positive value", k_eff);
+
+  log_printf(NORMAL, "Computing the flux with GMRES...");
+
+  _timer->clearSplits();
+  _timer->startTimer();
+
+  initializeSolver(mode);
+  _solver->_k_eff = k_eff;
+
+  double* x = new double[_size];
+  double* b = new double[_size];
+
+  /* Sweep the fixed sources alone for the uncollided flux */
+#pragma omp parallel for schedule(static)
+  for (long i=0; i < _size; i++)
+    x[i] = 0.;
+
+  loadFluxes(x);
+  _solver->computeFSRSources();
+  _solver->transportSweep();
+  _solver->addSourceToScalarFlux();
+  _num_total_sweeps++;
+
+  retrieveFluxes(b);
+
+  /* The operator sweeps exclude the fixed sources */
+  FP_PRECISION* fixed_sources = _solver->_fixed_sources;
+  long num_sources = (long) _solver->_num_FSRs * _solver->_num_groups;
+  _saved_fixed_sources = new FP_PRECISION[num_sources];
+
+#pragma omp parallel for schedule(static)
+  for (long i=0; i < num_sources; i++) {
+    _saved_fixed_sources[i] = fixed_sources[i];
+    fixed_sources[i] = 0.;
+  }
+
+  int iters = solveGMRES(TRANSPORT_OPERATOR, x, b, true);
+
+#pragma omp parallel for schedule(static)
+  for (long i=0; i < num_sources; i++)
+    fixed_sources[i] = _saved_fixed_sources[i];
+
+  delete [] _saved_fixed_sources;
+  _saved_fixed_sources = NULL;
+
+  loadFluxes(x);
+  _solver->storeFSRFluxes();
+
+  delete [] x;
+  delete [] b;
+
+  _solver->resetMaterials(mode);
+
+  _timer->stopTimer();
+  _timer->recordSplit("Total time");
+
+  log_printf(NORMAL, "Computed the flux with %d GMRES iterations and %d "
+             "transport sweeps in %1.4E sec", iters, _num_total_sweeps,
+             _timer->getTime());
+}
@@ -0,0 +1,156 @@
+/**
+ * @file KrylovSolver.h
+ * @brief The KrylovSolver class.
+ */
+
+
+#ifndef KRYLOVSOLVER_H_
+#define KRYLOVSOLVER_H_
+
+#ifdef __cplusplus
+#ifdef SWIG
+#include "Python.h"
+#endif
+#include "Solver.h"
+#include "Timer.h"
+#include "log.h"
+#include <math.h>
+#include <omp.h>
+#endif
+
+
+/**
+ * @enum krylovOperator
+ * @brief The linear operators built from transport sweeps which are
+ *        inverted with GMRES by the KrylovSolver.
+ */
+enum krylovOperator {
+
+  /** The scattering operator (I - TS) of the generalized eigenvalue
+   *  problem, where T is a transport sweep */
+  SCATTER_OPERATOR,
+
+  /** The fixed source operator (I - T(S + F/k)) */
+  TRANSPORT_OPERATOR
+};
+
+
+/**
+ * @class KrylovSolver KrylovSolver.h "src/KrylovSolver.h"
+ * @brief Matrix-free Krylov subspace methods built on a Solver's transport
+ *        sweeps.
+ * @details The KrylovSolver applies the scattering, fission and transport
+ *          operators by sweeping with the Solver's own flux and source
+ *          arrays. It inverts them with restarted GMRES, and computes the
+ *          eigenmodes of the k-eigenvalue problem (I - TS)^-1 TF with the
+ *          implicitly restarted Arnoldi method. The operators are only
+ *          linear with vacuum boundary conditions.
+ */
+class KrylovSolver {
+
+private:
+
+  /** The Solver used to apply the transport operators */
+  Solver* _solver;
+
+  /** The number of energy groups in each Krylov vector, excluding any
+   *  padding of the Solver's groups for vector alignment */
+  int _num_groups;
+
+  /** The number of unknowns (# FSRs x # groups) in each Krylov vector */
+  long _size;
+
+  /** The number of eigenmodes to compute */
+  int _num_modes;
+
+  /** The maximum dimension of the Arnoldi subspace, or 0 to choose it
+   *  from the number of eigenmodes */
+  int _subspace_size;
+
+  /** The number of GMRES iterations between restarts */
+  int _gmres_restart;
+
+  /** The maximum number of GMRES iterations for each linear solve */
+  int _max_inner_iters;
+
+  /** The maximum number of implicit restarts of the Arnoldi method */
+  int _max_outer_iters;
+
+  /** The relative residual tolerance for the GMRES solves */
+  double _inner_tol;
+
+  /** The relative residual tolerance for the Ritz eigenpairs */
+  double _outer_tol;
+
+  /** The number of transport sweeps with the scattering source */
+  int _num_scatter_sweeps;
+
+  /** The number of transport sweeps with the fission source */
+  int _num_fission_sweeps;
+
+  /** The number of transport sweeps with the total source */
+  int _num_total_sweeps;
+
+  /** The number of converged eigenmodes */
+  int _num_converged;
+
+  /** The real parts of the eigenvalues */
+  double* _eigenvalues_real;
+
+  /** The imaginary parts of the eigenvalues */
+  double* _eigenvalues_imag;
+
+  /** The real parts of the eigenvectors, stored contiguously by mode */
+  double* _eigenvectors;
+
+  /** A copy of the Solver's fixed sources while they are zeroed */
+  FP_PRECISION* _saved_fixed_sources;
+
+  /** A timer to record the time spent in each solve */
+  Timer* _timer;
+
+  void initializeSolver(solverMode mode);
+  void checkBoundaryConditions();
+  void clearEigenmodes();
+
+  void loadFluxes(double* x);
+  void retrieveFluxes(double* x);
+  void applyOperator(krylovOperator op, double* x, double* y);
+  void applyFissionOperator(double* x, double* y);
+  void applyEigenOperator(double* x, double* y);
+  int solveGMRES(krylovOperator op, double* x, double* b, bool verbose);
+
+  double dotProduct(double* x, double* y);
+  void orthogonalize(double* basis, int num_vectors, double* w, double* h);
+
+public:
+  KrylovSolver(Solver* solver);
+  virtual ~KrylovSolver();
+
+  int getNumModes();
+  int getNumConvergedModes();
+  int getSubspaceSize();
+  int getGMRESRestart();
+  double getInnerTolerance();
+  double getOuterTolerance();
+  int getNumScatterSweeps();
+  int getNumFissionSweeps();
+  int getNumTotalSweeps();
+  double getEigenvalue(int mode);
+  double getEigenvalueImag(int mode);
+  void getEigenvector(int mode, double* eigenvector, int num_fluxes);
+
+  void setNumModes(int num_modes);
+  void setSubspaceSize(int subspace_size);
+  void setGMRESRestart(int restart);
+  void setMaxInnerIterations(int max_iters);
+  void setMaxOuterIterations(int max_iters);
+  void setInnerTolerance(double tolerance);
+  void setOuterTolerance(double tolerance);
+
+  void computeEigenmodes(solverMode mode=FORWARD);
+  void computeFlux(solverMode mode=FORWARD, double k_eff=1.);
+};
+
+
+#endif /* KRYLOVSOLVER_H_ */
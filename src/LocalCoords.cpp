@@ -13,6 +13,9 @@ LocalCoords::LocalCoords(double x, double y, double z) {
   _cell = NULL;
   _next = NULL;
   _prev = NULL;
+  _levels = NULL;
+  _num_levels = 0;
+  _in_array = false;
 }
 
 
@@ -284,6 +287,56 @@ void LocalCoords::setPrev(LocalCoords* prev) {
 }
 
 
+/**
+ * @brief Sets an array of LocalCoords to use for the levels below this one.
+ * @details The LocalCoords at the next lower level is taken from the first
+ *          element of the array, the one below that from the second element,
+ *          and so on. Levels beyond the end of the array are allocated on the
+ *          heap. An array sized to Geometry::getMaxNestingDepth() allows ray
+ *          tracing without touching the heap. The array must outlive the
+ *          linked list of LocalCoords.
+ * @param levels an array of LocalCoords, or NULL to use the heap
+ * @param num_levels the number of LocalCoords in the array
+ */
+void LocalCoords::setLevels(LocalCoords* levels, int num_levels) {
+  _levels = levels;
+  _num_levels = (levels == NULL) ? 0 : num_levels;
+}
+
+
+/**
+ * @brief Returns the LocalCoords at the next lower level, creating it if
+ *        there is none, and sets its coordinates.
+ * @details A new LocalCoords is taken from the array of lower levels if one
+ *          was set with setLevels() and is allocated on the heap otherwise.
+ * @param x the x-coordinate of the next lower level
+ * @param y the y-coordinate of the next lower level
+ * @param z the z-coordinate of the next lower level
+ * @return a pointer to the LocalCoords at the next lower level
+ */
+LocalCoords* LocalCoords::getNextCreate(double x, double y, double z) {
+
+  if (_next == NULL) {
+
+    /* Take the next level from the array, which passes on the rest of it */
+    if (_num_levels > 0) {
+      _next = _levels;
+      *_next = LocalCoords(x, y, z);
+      _next->setLevels(_levels + 1, _num_levels - 1);
+      _next->_in_array = true;
+    }
+    else
+      _next = new LocalCoords(x, y, z);
+
+    _next->setPrev(this);
+  }
+  else
+    _next->_coords.setCoords(x, y, z);
+
+  return _next;
+}
+
+
 /**
  * @brief Find and return the last LocalCoords in the linked list which
  *        represents the local coordinates on the lowest level of a geometry
@@ -370,10 +423,12 @@ void LocalCoords::prune() {
   LocalCoords* curr = getLowestLevel();
   LocalCoords* next = curr->getPrev();
 
-  /* Iterate over LocalCoords beneath this one in the linked list */
+  /* Iterate over LocalCoords beneath this one in the linked list, deleting
+   * those which were allocated on the heap */
   while (curr != this) {
     next = curr->getPrev();
-    delete curr;
+    if (!curr->_in_array)
+      delete curr;
     curr = next;
   }
 
@@ -384,9 +439,10 @@ void LocalCoords::prune() {
 
 /**
  * @brief Copies a LocalCoords' values to this one.
- * details Given a pointer to a LocalCoords, it first prunes it and then creates
- *         a copy of the linked list of LocalCoords in the linked list below
- *         this one to give to the input LocalCoords.
+ * details Given a pointer to a LocalCoords, it copies the linked list of
+ *         LocalCoords below this one into the linked list of the input
+ *         LocalCoords, reusing its existing levels, creating any missing
+ *         levels and deleting any extra levels.
  * @param coords a pointer to the LocalCoords to give the linked list copy to
  */
 void LocalCoords::copyCoords(LocalCoords* coords) {
@@ -394,11 +450,8 @@ void LocalCoords::copyCoords(LocalCoords* coords) {
   LocalCoords* curr1 = this;
   LocalCoords* curr2 = coords;
 
-  /* Prune the LocalCoords linked list */
-  curr2->prune();
-
-  /* Iterate over this LocalCoords linked list and create a
-   * copy of it for the input LocalCoords */
+  /* Iterate over this LocalCoords linked list and copy it into the input
+   * LocalCoords, reusing its linked list and creating new levels as needed */
   while (curr1 != NULL) {
     curr2->setX(curr1->getX());
     curr2->setY(curr1->getY());
@@ -420,14 +473,8 @@ void LocalCoords::copyCoords(LocalCoords* coords) {
 
     curr1 = curr1->getNext();
 
-    if (curr1 != NULL && curr2->getNext() == NULL) {
-      LocalCoords* new_coords = new LocalCoords(0.0, 0.0, 0.0);
-      curr2->setNext(new_coords);
-      new_coords->setPrev(curr2);
-      curr2 = new_coords;
-    }
-    else if (curr1 != NULL)
-      curr2 = curr2->getNext();
+    if (curr1 != NULL)
+      curr2 = curr2->getNextCreate(0.0, 0.0, 0.0);
   }
 
   /* Prune any remainder from the old coords linked list */
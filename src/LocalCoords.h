@@ -79,6 +79,17 @@ private:
   /** A pointer to the LocalCoords at the next higher nested Universe level */
   LocalCoords* _prev;
 
+  /** An array of LocalCoords from which the levels below this one are taken
+   *  instead of allocating them on the heap, or NULL */
+  LocalCoords* _levels;
+
+  /** The number of LocalCoords in the array of lower levels */
+  int _num_levels;
+
+  /** Whether this LocalCoords was taken from another's array of lower
+   *  levels, in which case it is not deleted when the list is pruned */
+  bool _in_array;
+
 public:
   LocalCoords(double x, double y, double z);
   virtual ~LocalCoords();
@@ -111,6 +122,8 @@ public:
   void incrementPhi(double phi);
   void setNext(LocalCoords *next);
   void setPrev(LocalCoords* coords);
+  void setLevels(LocalCoords* levels, int num_levels);
+  LocalCoords* getNextCreate(double x, double y, double z);
 
   LocalCoords* getLowestLevel();
   LocalCoords* getHighestLevel();
@@ -56,23 +56,6 @@ void MOCKernel::newTrack(Track* track) {
 }
 
 
-/**
- * @brief Prepares a VolumeKernel for a new Track
- * @details Resets the segment count and updates the weight for the new Track
- * @param track The new Track the MOCKernel prepares to handle
- */
-void VolumeKernel::newTrack(Track* track) {
-
-  /* Compute the Track cross-sectional area */
-  int azim_index = track->getAzimAngleIndex();
-  _weight = _quadrature->getAzimSpacing(azim_index)
-      * _quadrature->getAzimWeight(azim_index);
-
-  /* Reset the count */
-  _count = 0;
-}
-
-
 /**
  * @brief Destructor for MOCKernel
  */
@@ -102,32 +85,6 @@ void MOCKernel::setMaxOpticalLength(FP_PRECISION max_tau) {
 }
 
 
-/*
- * @brief Adds segment contribution to the FSR volume
- * @details The VolumeKernel execute function adds the product of the
- *          track length and track weight to the buffer array at index
- *          id, referring to the array of FSR volumes.
- * @param length segment length
- * @param mat Material associated with the segment
- * @param id the FSR ID of the FSR associated with the segment
- */
-void VolumeKernel::execute(FP_PRECISION length, Material* mat, int id,
-                           int cmfd_surface_fwd, int cmfd_surface_bwd) {
-
-  /* Set omp lock for FSRs */
-  omp_set_lock(&_FSR_locks[id]);
-
-  /* Add value to buffer */
-  _FSR_volumes[id] += _weight * length;
-
-  /* Unset lock */
-  omp_unset_lock(&_FSR_locks[id]);
-
-  /* Increment count */
-  _count++;
-}
-
-
 /*
  * @brief Increments the counter for the number of segments on the track
  * @details The CounterKernel execute function counts the number of segments
@@ -92,9 +92,10 @@ public:
  *          is initialized with a pointer to floating point data and adds
  *          the product of the length and the weight to the floating point data
  *          at an input index. The weight corresponds to the weight of the
- *          track associated with the segments.
+ *          track associated with the segments. The class is final such that
+ *          calls to its execute function may be inlined by track traversals.
  */
-class VolumeKernel: public MOCKernel {
+class VolumeKernel final : public MOCKernel {
 
 private:
 
@@ -120,4 +121,47 @@ public:
 };
 
 
+/**
+ * @brief Prepares a VolumeKernel for a new Track
+ * @details Resets the segment count and updates the weight for the new Track
+ * @param track The new Track the MOCKernel prepares to handle
+ */
+inline void VolumeKernel::newTrack(Track* track) {
+
+  /* Compute the Track cross-sectional area */
+  int azim_index = track->getAzimAngleIndex();
+  _weight = _quadrature->getAzimSpacing(azim_index)
+      * _quadrature->getAzimWeight(azim_index);
+
+  /* Reset the count */
+  _count = 0;
+}
+
+
+/*
+ * @brief Adds segment contribution to the FSR volume
+ * @details The VolumeKernel execute function adds the product of the
+ *          track length and track weight to the buffer array at index
+ *          id, referring to the array of FSR volumes.
+ * @param length segment length
+ * @param mat Material associated with the segment
+ * @param id the FSR ID of the FSR associated with the segment
+ */
+inline void VolumeKernel::execute(FP_PRECISION length, Material* mat, int id,
+                                  int cmfd_surface_fwd, int cmfd_surface_bwd) {
+
+  /* Set omp lock for FSRs */
+  omp_set_lock(&_FSR_locks[id]);
+
+  /* Add value to buffer */
+  _FSR_volumes[id] += _weight * length;
+
+  /* Unset lock */
+  omp_unset_lock(&_FSR_locks[id]);
+
+  /* Increment count */
+  _count++;
+}
+
+
 #endif /* MOCKERNEL_H_ */
@@ -72,6 +72,8 @@ Material::Material(int id, const char* name) {
   _nu_sigma_f = NULL;
   _chi = NULL;
   _fiss_matrix = NULL;
+  _scatter_band_start = NULL;
+  _scatter_band_end = NULL;
 
   _fissionable = false;
 
@@ -89,6 +91,12 @@ Material::~Material() {
   if (_name != NULL)
     delete [] _name;
 
+  if (_scatter_band_start != NULL)
+    delete [] _scatter_band_start;
+
+  if (_scatter_band_end != NULL)
+    delete [] _scatter_band_end;
+
   /* If data is vector aligned */
   if (_data_aligned) {
     if (_sigma_t != NULL)
@@ -262,6 +270,35 @@ FP_PRECISION* Material::getFissionMatrix() {
 }
 
 
+/**
+ * @brief Return the first group which scatters into each energy group.
+ * @details The scattering bands are built by buildScatterBands().
+ * @return the pointer to the first source group of each energy group
+ */
+int* Material::getScatterBandStart() {
+  if (_scatter_band_start == NULL)
+    log_printf(ERROR, "Unable to return Material %d's scattering bands "
+               "since they have not yet been built", _id);
+
+  return _scatter_band_start;
+}
+
+
+/**
+ * @brief Return one past the last group which scatters into each energy
+ *        group.
+ * @details The scattering bands are built by buildScatterBands().
+ * @return the pointer to one past the last source group of each group
+ */
+int* Material::getScatterBandEnd() {
+  if (_scatter_band_end == NULL)
+    log_printf(ERROR, "Unable to return Material %d's scattering bands "
+               "since they have not yet been built", _id);
+
+  return _scatter_band_end;
+}
+
+
 /**
  * @brief Get the Material's total cross section for some energy group.
  * @param group the energy group
@@ -874,16 +911,30 @@ void Material::buildFissionMatrix() {
     log_printf(ERROR, "Unable to build Material %d's fission matrix "
                "since its chi spectrum has not been set", _id);
 
+  /* Aligned data is padded to a multiple of VEC_LENGTH energy groups */
+  int num_groups = _num_groups;
+  if (_data_aligned)
+    num_groups = _num_vector_groups * VEC_LENGTH;
+
   /* Deallocate memory for old fission matrix if needed */
-  if (_fiss_matrix != NULL)
-    delete [] _fiss_matrix;
+  if (_fiss_matrix != NULL) {
+    if (_data_aligned)
+      MM_FREE(_fiss_matrix);
+    else
+      delete [] _fiss_matrix;
+  }
 
-  _fiss_matrix = new FP_PRECISION[_num_groups*_num_groups];
+  if (_data_aligned) {
+    int size = num_groups * num_groups * sizeof(FP_PRECISION);
+    _fiss_matrix = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+  }
+  else
+    _fiss_matrix = new FP_PRECISION[num_groups*num_groups];
 
   /* Compute vector outer product of chi and the fission cross-section */
-  for (int G=0; G < _num_groups; G++) {
-    for (int g=0; g < _num_groups; g++)
-      _fiss_matrix[G*_num_groups+g] = _chi[G] * _nu_sigma_f[g];
+  for (int G=0; G < num_groups; G++) {
+    for (int g=0; g < num_groups; g++)
+      _fiss_matrix[G*num_groups+g] = _chi[G] * _nu_sigma_f[g];
   }
 }
 
@@ -988,6 +1039,59 @@ void Material::alignData() {
 }
 
 
+/**
+ * @brief Finds the band of groups which scatter into each energy group.
+ * @details Multigroup scattering matrices are mostly downscatter with a
+ *          narrow band of upscatter, such that most of the groups do not
+ *          scatter into a given group. For each destination group, this
+ *          method finds the first and one past the last origin group with
+ *          a non-zero scattering cross-section, so that the scattering
+ *          source may be summed over the band alone. A group into which
+ *          no group scatters has an empty band. The bands must be rebuilt
+ *          if the scattering matrix is modified or transposed.
+ */
+void Material::buildScatterBands() {
+
+  if (_num_groups <= 0)
+    log_printf(ERROR, "Unable to build Material %d's scattering bands "
+               "since the number of energy groups has not been set", _id);
+  else if (_sigma_s == NULL)
+    log_printf(ERROR, "Unable to build Material %d's scattering bands "
+               "since its scattering cross-section has not been set", _id);
+
+  /* Aligned data is padded to a multiple of VEC_LENGTH energy groups */
+  int row_length = _num_groups;
+  if (_data_aligned)
+    row_length = _num_vector_groups * VEC_LENGTH;
+
+  if (_scatter_band_start != NULL)
+    delete [] _scatter_band_start;
+  if (_scatter_band_end != NULL)
+    delete [] _scatter_band_end;
+
+  _scatter_band_start = new int[_num_groups];
+  _scatter_band_end = new int[_num_groups];
+
+  for (int G=0; G < _num_groups; G++) {
+
+    FP_PRECISION* sigma_s = &_sigma_s[G*row_length];
+    int start = 0;
+    int end = _num_groups;
+
+    while (start < end && sigma_s[start] == 0.)
+      start++;
+    while (end > start && sigma_s[end-1] == 0.)
+      end--;
+
+    if (start == end)
+      start = end = 0;
+
+    _scatter_band_start[G] = start;
+    _scatter_band_end[G] = end;
+  }
+}
+
+
 /**
  * @brief Transposes the scattering and fission matrices.
  * @details This routine is used by the Solver when performing
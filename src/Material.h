@@ -33,11 +33,26 @@
 #define MM_FREE(array) free(array)
 
 /** Word-aligned memory allocation for GNU's compiler */
-#define MM_MALLOC(size,alignment) malloc(size)
+#define MM_MALLOC(size,alignment) aligned_malloc(size, alignment)
 
 #endif
 
 
+/**
+ * @brief Allocates memory aligned to a power-of-two byte boundary.
+ * @param size the number of bytes to allocate
+ * @param alignment the byte alignment (a power of two multiple of the
+ *        size of a pointer)
+ * @return a pointer to the allocated memory or NULL if it failed
+ */
+inline void* aligned_malloc(size_t size, size_t alignment) {
+  void* ptr;
+  if (posix_memalign(&ptr, alignment, size) != 0)
+    return NULL;
+  return ptr;
+}
+
+
 int material_id();
 void reset_material_id();
 void maximize_material_id(int material_id);
@@ -86,6 +101,12 @@ private:
   /** A 2D array of the fission matrix from/into each group */
   FP_PRECISION* _fiss_matrix;
 
+  /** The first group which scatters into each energy group */
+  int* _scatter_band_start;
+
+  /** One past the last group which scatters into each energy group */
+  int* _scatter_band_end;
+
   /** A boolean representing whether or not this Material contains a non-zero
    *  fission cross-section and is fissionable */
   bool _fissionable;
@@ -112,6 +133,8 @@ public:
   FP_PRECISION* getNuSigmaF();
   FP_PRECISION* getChi();
   FP_PRECISION* getFissionMatrix();
+  int* getScatterBandStart();
+  int* getScatterBandEnd();
   FP_PRECISION getSigmaTByGroup(int group);
   FP_PRECISION getSigmaSByGroup(int origin, int destination);
   FP_PRECISION getSigmaFByGroup(int group);
@@ -142,6 +165,7 @@ public:
   void setChiByGroup(double xs, int group);
 
   void buildFissionMatrix();
+  void buildScatterBands();
   void transposeProductionMatrices();
   void alignData();
   Material* clone();
@@ -84,7 +84,7 @@ class ParallelHashMap {
     volatile long pad_L5;
     volatile long pad_L7;
     volatile long pad_L8;
-    FixedHashMap<K,V> volatile* value;
+    FixedHashMap<K,V>* volatile value;
     volatile long pad_R1;
     volatile long pad_R2;
     volatile long pad_R3;
@@ -115,6 +115,7 @@ class ParallelHashMap {
     size_t size();
     size_t bucket_count();
     size_t num_locks();
+    void setNumThreads(int num_threads);
     K* keys();
     V* values();
     void clear();
@@ -122,6 +123,42 @@ class ParallelHashMap {
 };
 
 
+/**
+ * @class FrozenHashMap ParallelHashMap.h "src/ParallelHashMap.h"
+ * @brief A read-only hash map built once from a list of key/value pairs
+ * @details The FrozenHashMap class stores its key/value pairs in a single
+ *    open addressing table with linear probing which is at most half full.
+ *    Once built it is never modified, so lookups from any number of threads
+ *    take no locks, make no announcements and allocate no memory. It is
+ *    intended to index data which is fixed after initialization.
+ */
+template <class K, class V>
+class FrozenHashMap {
+  struct slot {
+    K key;
+    V value;
+    bool occupied;
+  };
+
+  private:
+    size_t _M;      /* table size */
+    size_t _N;      /* number of elements present in table */
+    slot* _slots;   /* slots of key/value pairs */
+
+  public:
+
+    FrozenHashMap();
+    virtual ~FrozenHashMap();
+    void build(K* keys, V* values, size_t N);
+    bool find(K key, V& value) const;
+    bool contains(K key) const;
+    V at(K key) const;
+    size_t size() const;
+    size_t bucket_count() const;
+    void clear();
+};
+
+
 /**
  * @brief Constructor initializes fixed-size table of buckets filled with empty
  *      linked lists.
@@ -424,6 +461,167 @@ void FixedHashMap<K,V>::print_buckets() {
 }
 
 
+/**
+ * @brief Constructor initializes an empty frozen table.
+ */
+template <class K, class V>
+FrozenHashMap<K,V>::FrozenHashMap() {
+  _M = 0;
+  _N = 0;
+  _slots = NULL;
+}
+
+
+/**
+ * @brief Destructor deletes the table of slots.
+ */
+template <class K, class V>
+FrozenHashMap<K,V>::~FrozenHashMap() {
+  clear();
+}
+
+
+/**
+ * @brief Builds the table from arrays of keys and values.
+ * @details Any previous contents of the table are discarded. The table size
+ *      is the smallest power of 2 at least twice the number of pairs so
+ *      that probe sequences remain short. If a key appears more than once,
+ *      the first value is kept. This method is not thread safe and must not
+ *      be called while other threads are reading from the table.
+ * @param keys an array of keys
+ * @param values an array of the values associated with each key
+ * @param N the number of key/value pairs
+ */
+template <class K, class V>
+void FrozenHashMap<K,V>::build(K* keys, V* values, size_t N) {
+
+  clear();
+
+  /* find the smallest power of 2 at least twice the number of pairs */
+  size_t M = 64;
+  while (M < 2*N)
+    M *= 2;
+
+  /* allocate table */
+  _M = M;
+  _N = 0;
+  _slots = new slot[_M];
+  for (size_t i=0; i<_M; i++)
+    _slots[i].occupied = false;
+
+  /* place each pair in the first free slot of its probe sequence */
+  for (size_t n=0; n<N; n++) {
+    size_t key_hash = std::hash<K>()(keys[n]) & (_M-1);
+
+    while (_slots[key_hash].occupied && !(_slots[key_hash].key == keys[n]))
+      key_hash = (key_hash + 1) & (_M-1);
+
+    if (!_slots[key_hash].occupied) {
+      _slots[key_hash].key = keys[n];
+      _slots[key_hash].value = values[n];
+      _slots[key_hash].occupied = true;
+      _N++;
+    }
+  }
+}
+
+
+/**
+ * @brief Determine the value associated with a given key if it is present.
+ * @details The slots following the slot associated with the key are
+ *      searched until the key or an empty slot is found. No exception is
+ *      thrown when the key is not present.
+ * @param key key to be searched
+ * @param value set to the value associated with the key if it is present
+ * @return boolean value referring to whether the key is contained in the map
+ */
+template <class K, class V>
+inline bool FrozenHashMap<K,V>::find(K key, V& value) const {
+
+  if (_N == 0)
+    return false;
+
+  /* get hash into table assuming M is a power of 2, using fast modulus */
+  size_t key_hash = std::hash<K>()(key) & (_M-1);
+
+  /* probe slots until the key or an empty slot is found */
+  while (_slots[key_hash].occupied) {
+    if (_slots[key_hash].key == key) {
+      value = _slots[key_hash].value;
+      return true;
+    }
+    key_hash = (key_hash + 1) & (_M-1);
+  }
+
+  return false;
+}
+
+
+/**
+ * @brief Determine whether the frozen table contains a given key
+ * @param key key to be searched
+ * @return boolean value referring to whether the key is contained in the map
+ */
+template <class K, class V>
+bool FrozenHashMap<K,V>::contains(K key) const {
+  V value;
+  return find(key, value);
+}
+
+
+/**
+ * @brief Determine the value associated with a given key in the frozen
+ *      table.
+ * @details An exception is thrown if the key is not present in the map.
+ * @param key key whose corresponding value is desired
+ * @return value associated with the given key
+ */
+template <class K, class V>
+V FrozenHashMap<K,V>::at(K key) const {
+
+  V value;
+  if (find(key, value))
+    return value;
+
+  throw std::out_of_range("Key not present in map");
+}
+
+
+/**
+ * @brief Returns the number of key/value pairs in the frozen table
+ * @return number of key/value pairs in the map
+ */
+template <class K, class V>
+size_t FrozenHashMap<K,V>::size() const {
+  return _N;
+}
+
+
+/**
+ * @brief Returns the number of slots in the frozen table
+ * @return number of slots in the map
+ */
+template <class K, class V>
+size_t FrozenHashMap<K,V>::bucket_count() const {
+  return _M;
+}
+
+
+/**
+ * @brief Clears all key/value pairs from the frozen table.
+ */
+template <class K, class V>
+void FrozenHashMap<K,V>::clear() {
+
+  if (_slots != NULL)
+    delete [] _slots;
+
+  _slots = NULL;
+  _M = 0;
+  _N = 0;
+}
+
+
 /**
  * @brief Constructor generates initial underlying table as a fixed-sized
  *      hash map and intializes concurrency structures.
@@ -443,6 +641,8 @@ ParallelHashMap<K,V>::ParallelHashMap(size_t M, size_t L) {
     omp_init_lock(&_locks[i]);
 
   _announce = new paddedPointer[_num_threads];
+  for (size_t i=0; i<_num_threads; i++)
+    _announce[i].value = NULL;
 }
 
 
@@ -730,6 +930,37 @@ size_t ParallelHashMap<K,V>::num_locks() {
 }
 
 
+/**
+ * @brief Sets the number of threads which may access the parallel hash map.
+ * @details Each thread announces the table it is reading in its own entry
+ *      of the announce array, so the array must have an entry for every
+ *      thread. The number of threads is taken from OpenMP when the map is
+ *      constructed, which may be before the number of threads is set by
+ *      the user. The array is only ever enlarged, since the map may later
+ *      be searched by more threads than the caller uses, e.g. by a Solver
+ *      after the Tracks were segmented with fewer threads. This method must
+ *      not be called while other threads are accessing the map.
+ * @param num_threads the number of threads which may access the map
+ */
+template <class K, class V>
+void ParallelHashMap<K,V>::setNumThreads(int num_threads) {
+
+  if (num_threads <= 0)
+    log_printf(ERROR, "Unable to set the number of threads for the "
+               "ParallelHashMap to %d since it is less than or equal to 0",
+               num_threads);
+
+  if ((size_t)num_threads <= _num_threads)
+    return;
+
+  delete [] _announce;
+  _num_threads = num_threads;
+  _announce = new paddedPointer[_num_threads];
+  for (size_t i=0; i<_num_threads; i++)
+    _announce[i].value = NULL;
+}
+
+
 /**
  * @brief Returns an array of the keys in the underlying table
  * @details All buckets are scanned in order to form a list of all keys
@@ -5,7 +5,6 @@
  * @brief Constructor initializes an empty Point.
  */
 Point::Point() {
-  _xyz = new double[3];
   _xyz[0] = 0.0;
   _xyz[1] = 0.0;
   _xyz[2] = 0.0;
@@ -15,9 +14,7 @@ Point::Point() {
 /**
  * @brief Destructor
  */
-Point::~Point() {
-  delete [] _xyz;
-}
+Point::~Point() { }
 
 
 /**
@@ -25,8 +25,9 @@ class Point {
 
 private:
 
-  /** The Point's coordinates */
-  double* _xyz;
+  /** The Point's coordinates, stored inline so that Points and the
+   *  LocalCoords containing them can be created without touching the heap */
+  double _xyz[3];
 
 public:
   Point();
@@ -348,6 +348,27 @@ bool Intersection::containsPoint(Point* point) {
 }
 
 
+/**
+ * @brief Determines whether a Point is inside the Intersection and not on
+ *        any of its Surfaces.
+ * @details This point is only strictly inside the Intersection if it is
+ *          strictly inside each and every node.
+ * @param point a pointer to a Point
+ * @returns true if the Point is strictly inside the Intersection
+ */
+bool Intersection::containsPointStrictly(Point* point) {
+
+  /* Query each of the Intersection's nodes */
+  std::vector<Region*>::iterator iter;
+  for (iter = _nodes.begin(); iter != _nodes.end(); iter++) {
+    if (!(*iter)->containsPointStrictly(point))
+      return false;
+  }
+
+  return true;
+}
+
+
 /**
  * @brief Constructor sets the type of Region (UNION).
  */
@@ -376,6 +397,29 @@ bool Union::containsPoint(Point* point) {
 }
 
 
+/**
+ * @brief Determines whether a Point is inside the Union and not on any of
+ *        its Surfaces.
+ * @details The Point is taken to be strictly inside the Union if it is
+ *          strictly inside any node. A Point on a Surface shared by two
+ *          nodes is inside the Union but is conservatively reported as not
+ *          strictly inside it.
+ * @param point a pointer to a Point
+ * @returns true if the Point is strictly inside a node of the Union
+ */
+bool Union::containsPointStrictly(Point* point) {
+
+  /* Query each of the Union's nodes */
+  std::vector<Region*>::iterator iter;
+  for (iter = _nodes.begin(); iter != _nodes.end(); iter++) {
+    if ((*iter)->containsPointStrictly(point))
+      return true;
+  }
+
+  return false;
+}
+
+
 /**
  * @brief Constructor sets the type of Region (COMPLEMENT).
  */
@@ -400,6 +444,20 @@ bool Complement::containsPoint(Point* point) {
 }
 
 
+/**
+ * @brief Determines whether a Point is inside the Complement and not on any
+ *        of its Surfaces.
+ * @details Since the node of a Complement may itself exclude its Surfaces,
+ *          no Point is conservatively reported as strictly inside a
+ *          Complement.
+ * @param point a pointer to a Point
+ * @returns false
+ */
+bool Complement::containsPointStrictly(Point* point) {
+  return false;
+}
+
+
 /**
  * @brief Constructor sets the type of Region (HALFSPACE).
  * @param halfspace the side of the Surface (+1 or -1)
@@ -571,6 +629,24 @@ bool Halfspace::containsPoint(Point* point) {
 }
 
 
+/**
+ * @brief Determines whether a Point is inside the Halfspace and not on its
+ *        Surface.
+ * @details Points within ON_SURFACE_THRESH of the Surface, which are inside
+ *          both Halfspaces of the Surface, are not strictly inside either.
+ * @returns true if the Point is strictly inside the Halfspace
+ */
+bool Halfspace::containsPointStrictly(Point* point) {
+  double evaluation = _surface->evaluate(point);
+  if (fabs(evaluation) <= ON_SURFACE_THRESH)
+    return false;
+  else if (_halfspace == 1)
+    return (evaluation >= 0);
+  else
+   return (evaluation < 0);
+}
+
+
 /**
  * @brief Computes the minimum distance to the Surface in the Halfspace from
  *        a point with a given trajectory at a certain angle stored in a
@@ -79,6 +79,7 @@ public:
   virtual boundaryType getMaxYBoundaryType();
 
   virtual bool containsPoint(Point* point) =0;
+  virtual bool containsPointStrictly(Point* point) =0;
   virtual double minSurfaceDist(LocalCoords* coords);
   virtual Region* clone();
 };
@@ -93,6 +94,7 @@ class Intersection : public Region {
 public:
   Intersection();
   bool containsPoint(Point* point);
+  bool containsPointStrictly(Point* point);
 };
 
 
@@ -105,6 +107,7 @@ class Union : public Region {
  public:
   Union();
   bool containsPoint(Point* point);
+  bool containsPointStrictly(Point* point);
 };
 
 
@@ -117,6 +120,7 @@ class Complement : public Region {
 public:
   Complement();
   bool containsPoint(Point* point);  
+  bool containsPointStrictly(Point* point);
 };
 
 
@@ -155,6 +159,7 @@ public:
   boundaryType getMaxYBoundaryType();
 
   bool containsPoint(Point* point);  
+  bool containsPointStrictly(Point* point);
   double minSurfaceDist(LocalCoords* coords);
 };
 
@@ -32,16 +32,30 @@
  *  (\f$ \frac{Q}{\Sigma_t} \f$) in each FSR and energy group */
 #define _reduced_sources(r,e) (_reduced_sources[(r)*_num_groups + (e)])
 
-/** Indexing macro for the angular fluxes for each polar angle and energy
- *  group for the outgoing reflective track for both the forward and
- *  reverse direction for a given track */
-#define _boundary_flux(i,j,p,e) (_boundary_flux[(i)*2*_polar_times_groups \
-                                                + (j)*_polar_times_groups \
-                                                + (p)*_num_groups + (e)])
-
-#define _start_flux(i,j,p,e) (_start_flux[(i)*2*_polar_times_groups \
-                                                + (j)*_polar_times_groups \
-                                                + (p)*_num_groups + (e)])
+/** Indexing macro for the incoming angular fluxes for each polar angle and
+ *  energy group for the forward (j=0) or reverse (j=1) direction of a
+ *  given track. Track ends with vacuum boundary conditions share the zero
+ *  block at the start of the array. */
+#define _boundary_flux(i,j,p,e) (_boundary_flux[ \
+                                   _boundary_flux_offsets[2*(i) + (j)] \
+                                   + (p)*_num_groups + (e)])
+
+#define _start_flux(i,j,p,e) (_start_flux[ \
+                                _boundary_flux_offsets[2*(i) + (j)] \
+                                + (p)*_num_groups + (e)])
+
+/** Indexing macros for the total, nu-fission, scattering and fission matrix
+ *  cross sections of the Material in each FSR in the cross-section table */
+#define _FSR_sigma_t(r) (&_xs_table[(long)_FSR_material_indices[r] * \
+                                    _xs_stride])
+#define _FSR_nu_sigma_f(r) (_FSR_sigma_t(r) + _num_groups)
+#define _FSR_sigma_s(r) (_FSR_sigma_t(r) + 2*_num_groups)
+#define _FSR_fiss_matrix(r) (_FSR_sigma_t(r) + (_num_groups+2)*_num_groups)
+
+/** Indexing macro for the first and one past the last group which scatter
+ *  into each energy group of the Material in each FSR */
+#define _FSR_scatter_bands(r) (&_scatter_bands[2L * _num_groups * \
+                                               _FSR_material_indices[r]])
 
 /** Indexing scheme for fixed sources for each FSR and energy group */
 #define _fixed_sources(r,e) (_fixed_sources[(r)*_num_groups + (e)])
@@ -86,6 +100,27 @@ enum residualType {
 };
 
 
+/**
+ * @enum accelerationType
+ * @brief The accelerator applied to the outer source iterations of an
+ *        eigenvalue calculation.
+*/
+enum accelerationType {
+
+  /** Unaccelerated power iteration (default) */
+  NO_ACCELERATION,
+
+  /** Anderson mixing of the fluxes over a history of iterations */
+  ANDERSON,
+
+  /** Chebyshev extrapolation of the fluxes */
+  CHEBYSHEV,
+
+  /** A Wielandt shift of the eigenvalue with inner source iterations */
+  WIELANDT
+};
+
+
 /**
  * @class Solver Solver.h "src/Solver.h"
  * @brief This is an abstract base class which different Solver subclasses
@@ -93,6 +128,11 @@ enum residualType {
  */
 class Solver {
 
+#ifndef SWIG
+  /* The KrylovSolver sweeps with the Solver's flux and source arrays */
+  friend class KrylovSolver;
+#endif
+
 protected:
 
   /** The number of energy groups */
@@ -110,6 +150,25 @@ protected:
   /** The FSR Material pointers indexed by FSR UID */
   Material** _FSR_materials;
 
+  /** The index of each FSR's Material in the cross-section table */
+  int* _FSR_material_indices;
+
+  /** The number of entries in each Material's block of the cross-section
+   *  table, padded to a multiple of 64 bytes */
+  long _xs_stride;
+
+  /** A contiguous, 64-byte aligned block of the total, nu-fission,
+   *  scattering and fission matrix cross sections of each Material */
+  FP_PRECISION* _xs_table;
+
+  /** Whether the scattering sources are summed over the band of groups
+   *  which scatter into each group (true) or over all groups */
+  bool _sparse_scattering;
+
+  /** The first and one past the last group which scatter into each energy
+   *  group of each Material in the cross-section table */
+  int* _scatter_bands;
+
   /** A pointer to a TrackGenerator which contains Tracks */
   TrackGenerator* _track_generator;
 
@@ -140,6 +199,15 @@ protected:
   FP_PRECISION* _boundary_flux;
   FP_PRECISION* _start_flux;
 
+  /** The offset of the incoming angular fluxes for each Track and direction
+   *  into the boundary flux arrays. Track ends with vacuum boundary
+   *  conditions never receive flux and share a zero block at offset 0. */
+  long* _boundary_flux_offsets;
+
+  /** The number of blocks of angular fluxes in each boundary flux array,
+   *  including the shared zero block */
+  long _num_boundary_fluxes;
+
   /** The scalar flux for each energy group in each FSR */
   FP_PRECISION* _scalar_flux;
 
@@ -167,9 +235,57 @@ protected:
   /** The number of source iterations needed to reach convergence */
   int _num_iterations;
 
+  /** The number of transport sweeps needed to reach convergence */
+  int _num_transport_sweeps;
+
   /** The tolerance for converging the source/flux */
   FP_PRECISION _converge_thresh;
 
+  /** The accelerator applied to the outer iterations of computeEigenvalue */
+  accelerationType _acceleration;
+
+  /** The number of previous iterations used by Anderson mixing */
+  int _anderson_depth;
+
+  /** The number of extrapolated iterations in each Chebyshev cycle */
+  int _chebyshev_cycle_length;
+
+  /** The difference between the Wielandt shift and the eigenvalue */
+  FP_PRECISION _wielandt_shift;
+
+  /** The number of inner source iterations for each Wielandt iteration */
+  int _wielandt_inner_iterations;
+  FP_PRECISION _outer_shift;
+  bool _first_outer;
+  double _last_k;
+
+  /** The number of fluxes in each state vector of the accelerator */
+  long _acceleration_size;
+
+  /** The state vectors kept by the accelerator between iterations */
+  FP_PRECISION* _acceleration_history;
+
+  /** The number of iterations since the accelerator was last restarted */
+  int _acceleration_step;
+
+  /** The inner products of the Anderson flux residual differences */
+  double* _anderson_matrix;
+
+  /** The normal equations solved for the Anderson mixing coefficients */
+  double* _anderson_system;
+
+  /** The Anderson mixing coefficients of the differences in the history */
+  double* _anderson_coefficients;
+
+  /** The number of consecutive failed Chebyshev extrapolation cycles */
+  int _failed_cycles;
+
+  /** The estimated dominance ratio used for Chebyshev extrapolation */
+  double _dominance_ratio;
+
+  /** The norm of the change in the state at the start of a Chebyshev cycle */
+  double _last_flux_change;
+
   /** An ExpEvaluator to compute exponentials in the transport equation */
   ExpEvaluator* _exp_evaluator;
 
@@ -182,7 +298,15 @@ protected:
   /** A pointer to a Coarse Mesh Finite Difference (CMFD) acceleration object */
   Cmfd* _cmfd;
 
-  void clearTimerSplits();
+  virtual void clearTimerSplits();
+
+  void initializeAcceleration();
+  void clearAcceleration();
+  void getAccelerationState(FP_PRECISION* state, FP_PRECISION scale);
+  void setAccelerationState(FP_PRECISION* state, FP_PRECISION scale);
+  void andersonMixing(double fission);
+  void chebyshevExtrapolation(double fission);
+  bool wielandtIteration(residualType res_type, double tolerance);
 
 public:
   Solver(TrackGenerator* track_generator=NULL);
@@ -195,17 +319,24 @@ public:
   FP_PRECISION getFSRVolume(int fsr_id);
   int getNumPolarAngles();
   int getNumIterations();
+  int getNumTransportSweeps();
   double getTotalTime();
   FP_PRECISION getKeff();
   FP_PRECISION getConvergenceThreshold();
   FP_PRECISION getMaxOpticalLength();
   bool isUsingDoublePrecision();
   bool isUsingExponentialInterpolation();
+  bool isUsingSparseScattering();
+  accelerationType getAcceleration();
 
   virtual FP_PRECISION getFSRSource(int fsr_id, int group);
   virtual FP_PRECISION getFlux(int fsr_id, int group);
   virtual void getFluxes(FP_PRECISION* out_fluxes, int num_fluxes) = 0;
   virtual FP_PRECISION* getBoundaryFlux(int track_id, bool fwd);
+  void getFluxesView(FP_PRECISION** view, int* num_FSRs, int* num_groups);
+  void getReducedSourcesView(FP_PRECISION** view, int* num_FSRs,
+                             int* num_groups);
+  void getFSRVolumesView(FP_PRECISION** view, int* num_FSRs);
 
   virtual void setTrackGenerator(TrackGenerator* track_generator);
   virtual void setConvergenceThreshold(FP_PRECISION threshold);
@@ -218,13 +349,20 @@ public:
   void setExpPrecision(FP_PRECISION precision);
   void useExponentialInterpolation();
   void useExponentialIntrinsic();
+  void setSparseScattering(bool sparse_scattering);
+  void setAcceleration(accelerationType acceleration);
+  void setAndersonDepth(int depth);
+  void setChebyshevCycleLength(int length);
+  void setWielandtShift(FP_PRECISION shift, int num_inner_iterations=2);
 
   virtual void initializeExpEvaluator();
   virtual void initializeMaterials(solverMode mode=FORWARD);
+  void initializeXSTable();
   virtual void initializeFSRs();
   virtual void countFissionableFSRs();
   virtual void initializeFixedSources();
   virtual void initializeCmfd();
+  void initializeBoundaryFluxOffsets();
 
   virtual void resetMaterials(solverMode mode=FORWARD);
   virtual void fissionTransportSweep();
@@ -327,7 +465,7 @@ public:
   */
   virtual void computeFSRFissionRates(double* fission_rates, int num_FSRs) = 0;
 
-  void printTimerReport();
+  virtual void printTimerReport();
 };
 
 
@@ -148,6 +148,24 @@ void Track::insertSegment(int index, segment* segment) {
 }
 
 
+/**
+ * @brief Resizes this Track's list of segments.
+ * @details Segments appended to the list are default constructed and
+ *          segments beyond the new size are removed. This is a helper
+ *          method for the TrackGenerator::splitSegments(...) routine
+ *          which fills in the split segments in place.
+ * @param num_segments the new number of segments
+ */
+void Track::setNumSegments(int num_segments) {
+  try {
+    _segments.resize(num_segments);
+  }
+  catch (std::exception &e) {
+    log_printf(ERROR, "Unable to resize the segments of Track");
+  }
+}
+
+
 /**
  * @brief Sets the direction in which the flux leaving this Track along its
  *        "forward" direction is passed.
@@ -354,10 +372,10 @@ int Track::getReflectiveTrackIndex() const {
 
 
 /**
- * @brief Deletes each of this Track's segments.
+ * @brief Deletes each of this Track's segments and releases their memory.
  */
 void Track::clearSegments() {
-  _segments.clear();
+  std::vector<segment>().swap(_segments);
 }
 
 
@@ -49,6 +49,63 @@ struct segment {
 };
 
 
+/**
+ * @struct segment_arrays
+ * @brief The segments of all Tracks in a structure-of-arrays layout.
+ * @details The segments are stored contiguously in Track UID order such that
+ *          the segments of the Track with UID i are found at the indices
+ *          [_track_offsets[i], _track_offsets[i+1]) of each array. Materials
+ *          are stored as indices into the _materials array. Once the Tracks
+ *          of a TrackGenerator are segmented, these arrays are the only copy
+ *          of their segments.
+ */
+struct segment_arrays {
+
+  /** The total number of segments */
+  long _num_segments;
+
+  /** The index of the first segment of each Track indexed by Track UID */
+  long* _track_offsets;
+
+  /** The length of each segment (cm) */
+  FP_PRECISION* _lengths;
+
+  /** The ID of the flat source region in which each segment resides */
+  int* _region_ids;
+
+  /** The index of the Material in which each segment resides */
+  int* _material_indices;
+
+  /** The ID of the mesh surface crossed by each segment's end point */
+  int* _cmfd_surfaces_fwd;
+
+  /** The ID of the mesh surface crossed by each segment's start point */
+  int* _cmfd_surfaces_bwd;
+
+  /** The index of the first forward CMFD surface crossing of each Track in
+   *  _crossings_fwd indexed by Track UID */
+  long* _crossing_offsets_fwd;
+
+  /** The segments which cross a CMFD surface at their end point, in
+   *  increasing order for each Track */
+  long* _crossings_fwd;
+
+  /** The index of the first reverse CMFD surface crossing of each Track in
+   *  _crossings_bwd indexed by Track UID */
+  long* _crossing_offsets_bwd;
+
+  /** The segments which cross a CMFD surface at their start point, in
+   *  decreasing order for each Track */
+  long* _crossings_bwd;
+
+  /** The number of Materials */
+  int _num_materials;
+
+  /** An array of Material pointers indexed by material index */
+  Material** _materials;
+};
+
+
 /**
  * @class Track Track.h "src/Track.h"
  * @brief A Track represents a characteristic line across the geometry.
@@ -146,6 +203,7 @@ public:
   void addSegment(segment* to_add);
   void removeSegment(int index);
   void insertSegment(int index, segment* segment);
+  void setNumSegments(int num_segments);
   void clearSegments();
   std::string toString();
 };
@@ -1,5 +1,7 @@
 #include "TrackGenerator.h"
 #include "TrackTraversingAlgorithms.h"
+#include <fcntl.h>
+#include <sys/mman.h>
 
 /**
  * @brief Constructor for the TrackGenerator assigns default values.
@@ -10,6 +12,25 @@
 TrackGenerator::TrackGenerator(Geometry* geometry, int num_azim,
                                double azim_spacing) {
 
+  /* The segment arrays must be initialized before setNumAzim() resets the
+   * TrackGenerator's status */
+  _segment_arrays._num_segments = 0;
+  _segment_arrays._track_offsets = NULL;
+  _segment_arrays._lengths = NULL;
+  _segment_arrays._region_ids = NULL;
+  _segment_arrays._material_indices = NULL;
+  _segment_arrays._cmfd_surfaces_fwd = NULL;
+  _segment_arrays._cmfd_surfaces_bwd = NULL;
+  _segment_arrays._crossing_offsets_fwd = NULL;
+  _segment_arrays._crossings_fwd = NULL;
+  _segment_arrays._crossing_offsets_bwd = NULL;
+  _segment_arrays._crossings_bwd = NULL;
+  _segment_arrays._num_materials = 0;
+  _segment_arrays._materials = NULL;
+  _track_schedule = NULL;
+  _track_file_map = NULL;
+  _track_file_map_size = 0;
+
   setNumThreads(1);
   _geometry = geometry;
   setNumAzim(num_azim);
@@ -53,6 +74,8 @@ TrackGenerator::~TrackGenerator() {
   if (_FSR_volumes != NULL)
     delete [] _FSR_volumes;
 
+  clearSegmentArrays();
+
   if (_quadrature != NULL && !_user_quadrature)
     delete _quadrature;
 
@@ -165,15 +188,7 @@ int TrackGenerator::getNumSegments() {
     log_printf(ERROR, "Unable to return the total number of segments since "
                "Tracks have not yet been generated.");
 
-  int num_segments = 0;
-
-  for (int i=0; i < _num_azim_2; i++) {
-#pragma omp parallel for reduction(+:num_segments)
-    for (int j=0; j < _num_tracks[i]; j++)
-      num_segments += _tracks[i][j].getNumSegments();
-  }
-
-  return num_segments;
+  return _segment_arrays._num_segments;
 }
 
 
@@ -317,27 +332,54 @@ FP_PRECISION TrackGenerator::getFSRVolume(int fsr_id) {
     log_printf(ERROR, "Unable to get the volume for FSR %d since the FSR IDs "
                "lie in the range (0, %d)", fsr_id, _geometry->getNumFSRs());
 
-  segment* curr_segment;
+  long* track_offsets = _segment_arrays._track_offsets;
+  FP_PRECISION* lengths = _segment_arrays._lengths;
+  int* region_ids = _segment_arrays._region_ids;
   FP_PRECISION volume = 0;
+  int uid = 0;
 
   /* Calculate the FSR's "volume" by accumulating the total length of *
    * all Track segments multipled by the Track "widths" for the FSR.  */
   for (int i=0; i < _num_azim_2; i++) {
-#pragma omp parallel for reduction(+:volume) private(curr_segment)
-    for (int j=0; j < _num_tracks[i]; j++) {
-      for (int s=0; s < _tracks[i][j].getNumSegments(); s++) {
-        curr_segment = _tracks[i][j].getSegment(s);
-        if (curr_segment->_region_id == fsr_id)
-          volume += curr_segment->_length * _quadrature->getAzimWeight(i)
-            * _quadrature->getAzimSpacing(i);
-      }
+    FP_PRECISION azim_weight = _quadrature->getAzimWeight(i);
+    FP_PRECISION azim_spacing = _quadrature->getAzimSpacing(i);
+    long first_segment = track_offsets[uid];
+    long last_segment = track_offsets[uid + _num_tracks[i]];
+
+#pragma omp parallel for reduction(+:volume)
+    for (long s=first_segment; s < last_segment; s++) {
+      if (region_ids[s] == fsr_id)
+        volume += lengths[s] * azim_weight * azim_spacing;
     }
+
+    uid += _num_tracks[i];
   }
 
   return volume;
 }
 
 
+/**
+ * @brief Finds the largest total cross-section of each Material referenced
+ *        by the segment arrays.
+ * @param segments the segment arrays
+ * @return the largest total cross-section of each Material index
+ */
+static std::vector<FP_PRECISION> getMaxSigmaT(segment_arrays* segments) {
+
+  std::vector<FP_PRECISION> max_sigma_t(segments->_num_materials, 0.);
+
+  for (int m=0; m < segments->_num_materials; m++) {
+    Material* material = segments->_materials[m];
+    FP_PRECISION* sigma_t = material->getSigmaT();
+    for (int e=0; e < material->getNumEnergyGroups(); e++)
+      max_sigma_t[m] = std::max(max_sigma_t[m], sigma_t[e]);
+  }
+
+  return max_sigma_t;
+}
+
+
 /**
  * @brief Calculates and returns the maximum optical length for any segment
  *        in the Geomtry.
@@ -348,31 +390,16 @@ FP_PRECISION TrackGenerator::getFSRVolume(int fsr_id) {
  */
 FP_PRECISION TrackGenerator::getMaxOpticalLength() {
 
+  std::vector<FP_PRECISION> max_sigma_t = getMaxSigmaT(&_segment_arrays);
+  FP_PRECISION* lengths = _segment_arrays._lengths;
+  int* material_indices = _segment_arrays._material_indices;
   FP_PRECISION max_optical_length = 0.;
 
-#pragma omp parallel
-  {
-    segment* curr_segment;
-    FP_PRECISION length;
-    Material* material;
-    FP_PRECISION* sigma_t;
-
-    /* Iterate over all tracks, segments, groups to find max optical length */
-    for (int i=0; i < _num_azim_2; i++) {
-#pragma omp for reduction(max:max_optical_length)
-      for (int j=0; j < _num_tracks[i]; j++) {
-        for (int s=0; s < _tracks[i][j].getNumSegments(); s++) {
-          curr_segment = _tracks[i][j].getSegment(s);
-          length = curr_segment->_length;
-          material = curr_segment->_material;
-          sigma_t = material->getSigmaT();
-
-          for (int e=0; e < material->getNumEnergyGroups(); e++)
-            max_optical_length = std::max(max_optical_length,
-                                          length*sigma_t[e]);
-        }
-      }
-    }
+  /* Iterate over all segments to find the max optical length */
+#pragma omp parallel for reduction(max:max_optical_length)
+  for (long s=0; s < _segment_arrays._num_segments; s++) {
+    FP_PRECISION tau = lengths[s] * max_sigma_t[material_indices[s]];
+    max_optical_length = std::max(max_optical_length, tau);
   }
 
   /* Update maximum optical path length */
@@ -578,12 +605,14 @@ void TrackGenerator::retrieveSegmentCoords(double* coords, int length_coords) {
                "segment but an array of length %d was input", getNumSegments(),
                NUM_VALUES_PER_RETRIEVED_SEGMENT, length_coords);
 
-  segment* curr_segment = NULL;
+  long* track_offsets = _segment_arrays._track_offsets;
+  FP_PRECISION* lengths = _segment_arrays._lengths;
+  int* region_ids = _segment_arrays._region_ids;
   double x0, x1, y0, y1, z;
   double phi;
-  segment* segments;
 
   int counter = 0;
+  int uid = 0;
 
   /* Loop over Track segments and populate array with their FSR ID and *
    * start/end points */
@@ -595,19 +624,16 @@ void TrackGenerator::retrieveSegmentCoords(double* coords, int length_coords) {
       z = _tracks[i][j].getStart()->getZ();
       phi = _tracks[i][j].getPhi();
 
-      segments = _tracks[i][j].getSegments();
+      for (long s=track_offsets[uid]; s < track_offsets[uid+1]; s++) {
 
-      for (int s=0; s < _tracks[i][j].getNumSegments(); s++) {
-        curr_segment = &segments[s];
-
-        coords[counter] = curr_segment->_region_id;
+        coords[counter] = region_ids[s];
 
         coords[counter+1] = x0;
         coords[counter+2] = y0;
         coords[counter+3] = z;
 
-        x1 = x0 + cos(phi) * curr_segment->_length;
-        y1 = y0 + sin(phi) * curr_segment->_length;
+        x1 = x0 + cos(phi) * lengths[s];
+        y1 = y0 + sin(phi) * lengths[s];
 
         coords[counter+4] = x1;
         coords[counter+5] = y1;
@@ -618,6 +644,8 @@ void TrackGenerator::retrieveSegmentCoords(double* coords, int length_coords) {
 
         counter += NUM_VALUES_PER_RETRIEVED_SEGMENT;
       }
+
+      uid++;
     }
   }
 
@@ -668,6 +696,7 @@ void TrackGenerator::generateTracks(bool store) {
   _timer->startTimer();
 
   /* Deletes Tracks arrays if Tracks have been generated */
+  clearSegmentArrays();
   if (_contains_tracks) {
     delete [] _num_tracks;
     delete [] _num_x;
@@ -678,6 +707,7 @@ void TrackGenerator::generateTracks(bool store) {
       delete [] _tracks[i];
 
     delete [] _tracks;
+    _contains_tracks = false;
   }
 
   /* Initialize the CMFD object */
@@ -841,6 +871,307 @@ segmentationType TrackGenerator::getSegmentFormation() {
 }
 
 
+/**
+ * @brief Returns the segments of all Tracks in a structure-of-arrays layout.
+ * @return a pointer to the segment arrays
+ */
+segment_arrays* TrackGenerator::getSegmentArrays() {
+
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to get the segment arrays since "
+               "tracks have not yet been generated");
+
+  return &_segment_arrays;
+}
+
+
+/**
+ * @brief Returns an array of all Tracks ordered by decreasing number of
+ *        segments.
+ * @details Tracks which cross the entire Geometry may have orders of magnitude
+ *          more segments than those near its corners. Distributing the Tracks
+ *          to threads with the longest first and the shortest last balances
+ *          the work among threads. Tracks with the same number of segments
+ *          are ordered by UID. The schedule is rebuilt if the segments have
+ *          changed since the last call. This method should not be called
+ *          from within an OpenMP parallel region.
+ * @return an array of Track pointers of length getNumTracks()
+ */
+Track** TrackGenerator::getTrackSchedule() {
+
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to get the Track schedule since "
+               "tracks have not yet been generated");
+
+  if (_track_schedule == NULL) {
+    int num_tracks = getNumTracks();
+    long* track_offsets = _segment_arrays._track_offsets;
+    _track_schedule = new Track*[num_tracks];
+    std::copy(_tracks_array, _tracks_array + num_tracks, _track_schedule);
+    std::stable_sort(_track_schedule, _track_schedule + num_tracks,
+                     [track_offsets](Track* track1, Track* track2) {
+      int uid1 = track1->getUid();
+      int uid2 = track2->getUid();
+      return track_offsets[uid1+1] - track_offsets[uid1] >
+             track_offsets[uid2+1] - track_offsets[uid2];
+    });
+  }
+
+  return _track_schedule;
+}
+
+
+/**
+ * @brief Moves the segments of all Tracks into contiguous arrays in Track
+ *        UID order.
+ * @details Each segment's length, FSR ID, Material index and CMFD surfaces
+ *          are stored in separate arrays so that the transport sweep streams
+ *          through contiguous memory rather than following Track segment
+ *          vectors and Material pointers. The segments of each Track are
+ *          released once they are copied, such that the segments are only
+ *          stored once. This is called once the Tracks have been segmented
+ *          and before their UIDs are assigned, which follow the same order.
+ */
+void TrackGenerator::flattenSegments() {
+
+  /* Any previous segment arrays have already been deleted by
+   * clearSegmentArrays(), which also resets the Track schedule */
+  int num_tracks = getNumTracks();
+
+  /* Assign an index to each Material in the Geometry */
+  std::map<int, int> material_indices;
+  indexSegmentMaterials(material_indices);
+
+  try {
+    _segment_arrays._track_offsets = new long[num_tracks+1];
+  }
+  catch (std::exception &e) {
+    log_printf(ERROR, "Unable to allocate memory for the segment arrays");
+  }
+
+  /* Compute the offset to the first segment of each Track */
+  long num_segments = 0;
+  int uid = 0;
+  for (int i=0; i < _num_azim_2; i++) {
+    for (int j=0; j < _num_tracks[i]; j++) {
+      _segment_arrays._track_offsets[uid++] = num_segments;
+      num_segments += _tracks[i][j].getNumSegments();
+    }
+  }
+  _segment_arrays._track_offsets[num_tracks] = num_segments;
+  _segment_arrays._num_segments = num_segments;
+
+  try {
+    _segment_arrays._lengths = new FP_PRECISION[num_segments];
+    _segment_arrays._region_ids = new int[num_segments];
+    _segment_arrays._material_indices = new int[num_segments];
+    _segment_arrays._cmfd_surfaces_fwd = new int[num_segments];
+    _segment_arrays._cmfd_surfaces_bwd = new int[num_segments];
+  }
+  catch (std::exception &e) {
+    log_printf(ERROR, "Unable to allocate memory for %ld segments",
+               num_segments);
+  }
+
+  /* Move the segments of each Track into the arrays */
+  uid = 0;
+  for (int i=0; i < _num_azim_2; i++) {
+#pragma omp parallel for schedule(guided)
+    for (int j=0; j < _num_tracks[i]; j++) {
+
+      Track* track = &_tracks[i][j];
+      long offset = _segment_arrays._track_offsets[uid+j];
+
+      for (int s=0; s < track->getNumSegments(); s++) {
+        segment* curr_segment = track->getSegment(s);
+        _segment_arrays._lengths[offset+s] = curr_segment->_length;
+        _segment_arrays._region_ids[offset+s] = curr_segment->_region_id;
+        _segment_arrays._material_indices[offset+s] =
+            material_indices.at(curr_segment->_material->getId());
+        _segment_arrays._cmfd_surfaces_fwd[offset+s] =
+            curr_segment->_cmfd_surface_fwd;
+        _segment_arrays._cmfd_surfaces_bwd[offset+s] =
+            curr_segment->_cmfd_surface_bwd;
+      }
+
+      track->clearSegments();
+    }
+
+    uid += _num_tracks[i];
+  }
+
+  flattenCmfdCrossings();
+
+  log_printf(INFO, "Flattened %ld segments into arrays requiring %f MB",
+             num_segments, num_segments * (sizeof(FP_PRECISION) +
+             4 * sizeof(int)) / 1.E6);
+}
+
+
+/**
+ * @brief Lists the segments of each Track which cross a CMFD surface.
+ * @details The segments which cross a CMFD surface at their end point are
+ *          listed in increasing order for the forward direction, and those
+ *          which cross a CMFD surface at their start point in decreasing
+ *          order for the reverse direction, such that a transport sweep may
+ *          tally the CMFD surface currents without testing each segment.
+ *          The lists are built from the flattened CMFD surface arrays.
+ */
+void TrackGenerator::flattenCmfdCrossings() {
+
+  int num_tracks = getNumTracks();
+  long* track_offsets = _segment_arrays._track_offsets;
+  int* surfaces_fwd = _segment_arrays._cmfd_surfaces_fwd;
+  int* surfaces_bwd = _segment_arrays._cmfd_surfaces_bwd;
+
+  long* offsets_fwd = new long[num_tracks+1];
+  long* offsets_bwd = new long[num_tracks+1];
+
+  /* Count the crossings of each Track */
+#pragma omp parallel for schedule(guided)
+  for (int t=0; t < num_tracks; t++) {
+    long num_fwd = 0;
+    long num_bwd = 0;
+    for (long s=track_offsets[t]; s < track_offsets[t+1]; s++) {
+      num_fwd += (surfaces_fwd[s] != -1);
+      num_bwd += (surfaces_bwd[s] != -1);
+    }
+    offsets_fwd[t+1] = num_fwd;
+    offsets_bwd[t+1] = num_bwd;
+  }
+
+  offsets_fwd[0] = 0;
+  offsets_bwd[0] = 0;
+  for (int t=0; t < num_tracks; t++) {
+    offsets_fwd[t+1] += offsets_fwd[t];
+    offsets_bwd[t+1] += offsets_bwd[t];
+  }
+
+  long* crossings_fwd = new long[offsets_fwd[num_tracks]];
+  long* crossings_bwd = new long[offsets_bwd[num_tracks]];
+
+  /* List the crossings of each Track in the order they are swept */
+#pragma omp parallel for schedule(guided)
+  for (int t=0; t < num_tracks; t++) {
+    long c = offsets_fwd[t];
+    for (long s=track_offsets[t]; s < track_offsets[t+1]; s++)
+      if (surfaces_fwd[s] != -1)
+        crossings_fwd[c++] = s;
+
+    c = offsets_bwd[t];
+    for (long s=track_offsets[t+1]-1; s >= track_offsets[t]; s--)
+      if (surfaces_bwd[s] != -1)
+        crossings_bwd[c++] = s;
+  }
+
+  _segment_arrays._crossing_offsets_fwd = offsets_fwd;
+  _segment_arrays._crossings_fwd = crossings_fwd;
+  _segment_arrays._crossing_offsets_bwd = offsets_bwd;
+  _segment_arrays._crossings_bwd = crossings_bwd;
+}
+
+
+/**
+ * @brief Indexes the Materials in the Geometry for the segment arrays.
+ * @details The array of Materials referenced by the segments' Material
+ *          indices is replaced by the Materials currently in the Geometry,
+ *          ordered by Material ID. The Material indices of the segments
+ *          must be updated by the caller.
+ * @param material_indices a map filled with the index of each Material ID
+ */
+void TrackGenerator::indexSegmentMaterials(std::map<int, int>&
+                                           material_indices) {
+
+  std::map<int, Material*> materials = _geometry->getAllMaterials();
+  std::map<int, Material*>::iterator m_iter;
+  int num_materials = materials.size();
+
+  if (_segment_arrays._materials != NULL)
+    delete [] _segment_arrays._materials;
+
+  try {
+    _segment_arrays._materials = new Material*[num_materials];
+  }
+  catch (std::exception &e) {
+    log_printf(ERROR, "Unable to allocate memory for the segment Materials");
+  }
+
+  material_indices.clear();
+  int index = 0;
+  for (m_iter = materials.begin(); m_iter != materials.end(); ++m_iter) {
+    _segment_arrays._materials[index] = m_iter->second;
+    material_indices[m_iter->first] = index;
+    index++;
+  }
+  _segment_arrays._num_materials = num_materials;
+}
+
+
+/**
+ * @brief Deletes the segment arrays and the Track schedule.
+ * @details If the segment arrays point into a Track file mapping, the
+ *          mapping is unmapped.
+ */
+void TrackGenerator::clearSegmentArrays() {
+
+  /* Segment arrays in a Track file mapping are released with the mapping */
+  if (_track_file_map != NULL) {
+    munmap(_track_file_map, _track_file_map_size);
+    _track_file_map = NULL;
+    _track_file_map_size = 0;
+    _segment_arrays._track_offsets = NULL;
+    _segment_arrays._lengths = NULL;
+    _segment_arrays._region_ids = NULL;
+    _segment_arrays._material_indices = NULL;
+    _segment_arrays._cmfd_surfaces_fwd = NULL;
+    _segment_arrays._cmfd_surfaces_bwd = NULL;
+  }
+
+  if (_segment_arrays._track_offsets != NULL)
+    delete [] _segment_arrays._track_offsets;
+  if (_segment_arrays._lengths != NULL)
+    delete [] _segment_arrays._lengths;
+  if (_segment_arrays._region_ids != NULL)
+    delete [] _segment_arrays._region_ids;
+  if (_segment_arrays._material_indices != NULL)
+    delete [] _segment_arrays._material_indices;
+  if (_segment_arrays._cmfd_surfaces_fwd != NULL)
+    delete [] _segment_arrays._cmfd_surfaces_fwd;
+  if (_segment_arrays._cmfd_surfaces_bwd != NULL)
+    delete [] _segment_arrays._cmfd_surfaces_bwd;
+  if (_segment_arrays._materials != NULL)
+    delete [] _segment_arrays._materials;
+  if (_segment_arrays._crossing_offsets_fwd != NULL)
+    delete [] _segment_arrays._crossing_offsets_fwd;
+  if (_segment_arrays._crossings_fwd != NULL)
+    delete [] _segment_arrays._crossings_fwd;
+  if (_segment_arrays._crossing_offsets_bwd != NULL)
+    delete [] _segment_arrays._crossing_offsets_bwd;
+  if (_segment_arrays._crossings_bwd != NULL)
+    delete [] _segment_arrays._crossings_bwd;
+
+  _segment_arrays._num_segments = 0;
+  _segment_arrays._track_offsets = NULL;
+  _segment_arrays._lengths = NULL;
+  _segment_arrays._region_ids = NULL;
+  _segment_arrays._material_indices = NULL;
+  _segment_arrays._cmfd_surfaces_fwd = NULL;
+  _segment_arrays._cmfd_surfaces_bwd = NULL;
+  _segment_arrays._crossing_offsets_fwd = NULL;
+  _segment_arrays._crossings_fwd = NULL;
+  _segment_arrays._crossing_offsets_bwd = NULL;
+  _segment_arrays._crossings_bwd = NULL;
+  _segment_arrays._num_materials = 0;
+  _segment_arrays._materials = NULL;
+
+  /* The Track schedule depends upon the number of segments in each Track */
+  if (_track_schedule != NULL) {
+    delete [] _track_schedule;
+    _track_schedule = NULL;
+  }
+}
+
+
 /**
  * @brief Initializes Track azimuthal angles, start and end Points.
  * @details This method computes the azimuthal angles and effective track
@@ -1318,11 +1649,24 @@ void TrackGenerator::segmentize() {
    * Tracks were not read in from an input file */
   if (!_use_input_file) {
 
-    /* Loop over all Tracks */
-    for (int i=0; i < _num_azim_2; i++) {
-#pragma omp parallel for
-      for (int j=0; j < _num_tracks[i]; j++) {
-        _geometry->segmentize(&_tracks[i][j]);
+    /* The number of LocalCoords below the highest level along a Track */
+    int num_levels = _geometry->getMaxNestingDepth() - 1;
+
+    /* Each thread which searches the FSR hash map needs its own entry */
+    _geometry->getFSRKeysMap().setNumThreads(omp_get_max_threads());
+
+#pragma omp parallel
+    {
+      /* Each thread ray traces with LocalCoords from its own array rather
+       * than allocating them on the heap at each Cell crossing */
+      std::vector<LocalCoords> levels(2 * num_levels, LocalCoords(0., 0., 0.));
+
+      /* Loop over all Tracks */
+      for (int i=0; i < _num_azim_2; i++) {
+#pragma omp for
+        for (int j=0; j < _num_tracks[i]; j++) {
+          _geometry->segmentize(&_tracks[i][j], levels.data());
+        }
       }
     }
   }
@@ -1331,14 +1675,154 @@ void TrackGenerator::segmentize() {
 
   _contains_tracks = true;
 
+  /* Move the segments of all Tracks into the segment arrays */
+  flattenSegments();
+
   return;
 }
 
 
 /**
- * @brief Writes all Track and segment data to a "*.tracks" binary file.
+ * @brief Hashes a block of data with the 64-bit FNV-1a hash applied to
+ *        eight bytes at a time.
+ * @details A trailing partial word is padded with zeros.
+ * @param hash the hash of the preceding data
+ * @param data the data to hash
+ * @param size the number of bytes of data
+ * @return the hash including the data
+ */
+static uint64_t hashWords(uint64_t hash, const char* data, long size) {
+
+  long num_words = size / sizeof(uint64_t);
+  uint64_t word;
+
+  for (long i=0; i < num_words; i++) {
+    memcpy(&word, data + i * sizeof(uint64_t), sizeof(uint64_t));
+    hash = (hash ^ word) * 1099511628211ULL;
+  }
+
+  if (size % sizeof(uint64_t) != 0) {
+    word = 0;
+    memcpy(&word, data + num_words * sizeof(uint64_t),
+           size % sizeof(uint64_t));
+    hash = (hash ^ word) * 1099511628211ULL;
+  }
+
+  return hash;
+}
+
+
+/**
+ * @brief Rounds a size in bytes up to a multiple of TRACK_FILE_ALIGNMENT.
+ * @param size the size in bytes
+ * @return the aligned size in bytes
+ */
+static long alignTrackFileSection(long size) {
+  return (size + TRACK_FILE_ALIGNMENT - 1) / TRACK_FILE_ALIGNMENT *
+         TRACK_FILE_ALIGNMENT;
+}
+
+
+/**
+ * @brief Computes the size and offset of each section of a Track file from
+ *        the counts in its header.
+ * @param header the Track file header
+ * @param sizes an array for the size in bytes of each section
+ * @param offsets an array for the offset in bytes of each section
+ * @return the total size of the Track file in bytes
+ */
+static long layoutTrackFile(track_file_header* header, long* sizes,
+                            long* offsets) {
+
+  long num_segments = header->_num_segments;
+
+  sizes[TRACK_FILE_NUM_TRACKS] = (header->_num_azim / 2) * sizeof(int);
+  sizes[TRACK_FILE_NUM_X] = (header->_num_azim / 2) * sizeof(int);
+  sizes[TRACK_FILE_NUM_Y] = (header->_num_azim / 2) * sizeof(int);
+  sizes[TRACK_FILE_TRACKS] = header->_num_tracks * sizeof(track_file_track);
+  sizes[TRACK_FILE_TRACK_OFFSETS] = (header->_num_tracks + 1) * sizeof(long);
+  sizes[TRACK_FILE_LENGTHS] = num_segments * header->_fp_precision;
+  sizes[TRACK_FILE_REGION_IDS] = num_segments * sizeof(int);
+  sizes[TRACK_FILE_MATERIAL_INDICES] = num_segments * sizeof(int);
+  sizes[TRACK_FILE_CMFD_SURFACES_FWD] = num_segments * sizeof(int);
+  sizes[TRACK_FILE_CMFD_SURFACES_BWD] = num_segments * sizeof(int);
+  sizes[TRACK_FILE_MATERIAL_IDS] = header->_num_materials * sizeof(int);
+  sizes[TRACK_FILE_FSRS] = header->_num_FSRs * sizeof(track_file_fsr);
+  sizes[TRACK_FILE_FSR_KEYS] = header->_num_FSRs * sizeof(fsr_key);
+  sizes[TRACK_FILE_CMFD_CELL_OFFSETS] = 0;
+  if (header->_contains_cmfd)
+    sizes[TRACK_FILE_CMFD_CELL_OFFSETS] =
+         (header->_num_cmfd_cells + 1) * sizeof(long);
+  sizes[TRACK_FILE_CMFD_CELL_FSRS] = header->_num_cmfd_cell_fsrs * sizeof(int);
+
+  long offset = alignTrackFileSection(sizeof(track_file_header));
+  for (int k=0; k < NUM_TRACK_FILE_SECTIONS; k++) {
+    offsets[k] = offset;
+    offset += alignTrackFileSection(sizes[k]);
+  }
+
+  return offset;
+}
+
+
+/**
+ * @brief Writes a section of a Track file followed by zeros up to the
+ *        next TRACK_FILE_ALIGNMENT bytes and adds it to the checksum.
+ * @param out the Track file
+ * @param data the data in the section
+ * @param size the size of the data in bytes
+ * @param checksum the checksum of the preceding sections
+ * @return whether the section was written
+ */
+static bool writeTrackFileSection(FILE* out, const void* data, long size,
+                                  uint64_t* checksum) {
+
+  static const char zeros[TRACK_FILE_ALIGNMENT] = {0};
+  long padding = alignTrackFileSection(size) - size;
+
+  if (size > 0 && fwrite(data, 1, size, out) != (size_t) size)
+    return false;
+  if (padding > 0 && fwrite(zeros, 1, padding, out) != (size_t) padding)
+    return false;
+
+  *checksum = hashWords(*checksum, (const char*) data, size);
+  long num_zero_words = (alignTrackFileSection(size) -
+      (size + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t)) /
+      sizeof(uint64_t);
+  for (long i=0; i < num_zero_words; i++)
+    *checksum *= 1099511628211ULL;
+
+  return true;
+}
+
+
+/**
+ * @brief Returns a hash of the Geometry's string representation.
+ * @details The hash identifies the Geometry for which the Tracks in a
+ *          Track file were generated.
+ * @return the 64-bit FNV-1a hash of the Geometry's string representation
+ */
+uint64_t TrackGenerator::hashGeometry() {
+
+  std::string geometry_to_string = _geometry->toString();
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (size_t i=0; i < geometry_to_string.length(); i++)
+    hash = (hash ^ (unsigned char) geometry_to_string[i]) * 1099511628211ULL;
+
+  return hash;
+}
+
+
+/**
+ * @brief Writes all Track and segment data to a binary Track file.
  * @details Storing Tracks in a binary file saves time by eliminating ray
  *          tracing for Track segmentation in commonly simulated geometries.
+ *          The Track file starts with a track_file_header followed by each
+ *          trackFileSection as a contiguous array, such that the segments
+ *          may be memory mapped and swept in place by readTracksFromFile().
+ *          The file is written under a temporary name and then renamed so
+ *          that Track files mapped by other TrackGenerators are unaffected.
  */
 void TrackGenerator::dumpTracksToFile() {
 
@@ -1349,158 +1833,166 @@ void TrackGenerator::dumpTracksToFile() {
       "been generated for %d azimuthal angles and %f azimuthal track spacing",
       2*_num_azim_2, _azim_spacing);
 
-  FILE* out;
-  out = fopen(_tracks_filename.c_str(), "w");
-
-  /* Get a string representation of the Geometry's attributes. This is used to
-   * check whether or not ray tracing has been performed for this Geometry */
-  std::string geometry_to_string = _geometry->toString();
-  int string_length = geometry_to_string.length() + 1;
-
-  /* Write geometry metadata to the Track file */
-  fwrite(&string_length, sizeof(int), 1, out);
-  fwrite(geometry_to_string.c_str(), sizeof(char)*string_length, 1, out);
-
-  /* Write ray tracing metadata to the Track file */
-  int num_azim = 2 * _num_azim_2;
-  fwrite(&num_azim, sizeof(int), 1, out);
-  fwrite(&_azim_spacing, sizeof(double), 1, out);
-  fwrite(_num_tracks, sizeof(int), _num_azim_2, out);
-  fwrite(_num_x, sizeof(int), _num_azim_2, out);
-  fwrite(_num_y, sizeof(int), _num_azim_2, out);
-
-  Track* curr_track;
-  double x0, y0, z0, x1, y1, z1;
-  double phi;
-  int azim_angle_index;
-  int num_segments;
-  std::vector<segment*> _segments;
   Cmfd* cmfd = _geometry->getCmfd();
+  int num_FSRs = _geometry->getNumFSRs();
+  ParallelHashMap<fsr_key, fsr_data*>& FSR_keys_map =
+      _geometry->getFSRKeysMap();
+  std::vector<fsr_key>& FSRs_to_keys = _geometry->getFSRsToKeys();
+
+  /* Find the ID of the Material for each segment Material index */
+  std::vector<int> material_ids(_segment_arrays._num_materials);
+  for (int m=0; m < _segment_arrays._num_materials; m++)
+    material_ids[m] = _segment_arrays._materials[m]->getId();
+
+  /* Fill in the header with the number of each item in the Track file */
+  track_file_header header;
+  memset(&header, 0, sizeof(track_file_header));
+  strncpy(header._magic, TRACK_FILE_MAGIC, sizeof(header._magic));
+  header._version = TRACK_FILE_VERSION;
+  header._fp_precision = sizeof(FP_PRECISION);
+  header._geometry_hash = hashGeometry();
+  header._num_azim = 2 * _num_azim_2;
+  header._contains_cmfd = (cmfd != NULL);
+  header._azim_spacing = _azim_spacing;
+  header._num_materials = material_ids.size();
+  header._num_FSRs = num_FSRs;
+
+  header._num_tracks = getNumTracks();
+  header._num_segments = _segment_arrays._num_segments;
+
+  std::vector< std::vector<int> >* cell_fsrs = NULL;
+  if (cmfd != NULL) {
+    cell_fsrs = cmfd->getCellFSRs();
+    header._num_cmfd_cells = cmfd->getNumCells();
+    for (int cell=0; cell < header._num_cmfd_cells; cell++)
+      header._num_cmfd_cell_fsrs += cell_fsrs->at(cell).size();
+  }
+
+  long sizes[NUM_TRACK_FILE_SECTIONS];
+  long offsets[NUM_TRACK_FILE_SECTIONS];
+  header._file_size = layoutTrackFile(&header, sizes, offsets);
+  std::copy(offsets, offsets + NUM_TRACK_FILE_SECTIONS, header._offsets);
+
+  std::string temp_filename = _tracks_filename + ".tmp";
+  FILE* out = fopen(temp_filename.c_str(), "wb");
+
+  if (out == NULL) {
+    log_printf(WARNING, "Unable to open the Track file %s for writing",
+               temp_filename.c_str());
+    return;
+  }
 
-  segment* curr_segment;
-  double length;
-  int material_id;
-  int region_id;
-  int cmfd_surface_fwd;
-  int cmfd_surface_bwd;
+  /* Write a placeholder header which is overwritten with the checksum */
+  static const char zeros[TRACK_FILE_ALIGNMENT] = {0};
+  bool written = fwrite(&header, sizeof(track_file_header), 1, out) == 1;
+  written &= fwrite(zeros, 1, offsets[0] - sizeof(track_file_header), out) ==
+             (size_t) (offsets[0] - sizeof(track_file_header));
+
+  uint64_t checksum = 14695981039346656037ULL;
+  int num_tracks = header._num_tracks;
+
+  /* Write the number of Tracks for each azimuthal angle */
+  written &= writeTrackFileSection(out, _num_tracks,
+                                   sizes[TRACK_FILE_NUM_TRACKS], &checksum);
+  written &= writeTrackFileSection(out, _num_x, sizes[TRACK_FILE_NUM_X],
+                                   &checksum);
+  written &= writeTrackFileSection(out, _num_y, sizes[TRACK_FILE_NUM_Y],
+                                   &checksum);
+
+  /* Write the end points of each Track and the offsets to its segments */
+  std::vector<track_file_track> tracks(num_tracks);
+  long* track_offsets = _segment_arrays._track_offsets;
+  int uid = 0;
 
-  /* Loop over all Tracks */
   for (int i=0; i < _num_azim_2; i++) {
     for (int j=0; j < _num_tracks[i]; j++) {
-
-      /* Get data for this Track */
-      curr_track = &_tracks[i][j];
-      x0 = curr_track->getStart()->getX();
-      y0 = curr_track->getStart()->getY();
-      z0 = curr_track->getStart()->getZ();
-      x1 = curr_track->getEnd()->getX();
-      y1 = curr_track->getEnd()->getY();
-      z1 = curr_track->getEnd()->getZ();
-      phi = curr_track->getPhi();
-      azim_angle_index = curr_track->getAzimAngleIndex();
-      num_segments = curr_track->getNumSegments();
-
-      /* Write data for this Track to the Track file */
-      fwrite(&x0, sizeof(double), 1, out);
-      fwrite(&y0, sizeof(double), 1, out);
-      fwrite(&z0, sizeof(double), 1, out);
-      fwrite(&x1, sizeof(double), 1, out);
-      fwrite(&y1, sizeof(double), 1, out);
-      fwrite(&z1, sizeof(double), 1, out);
-      fwrite(&phi, sizeof(double), 1, out);
-      fwrite(&azim_angle_index, sizeof(int), 1, out);
-      fwrite(&num_segments, sizeof(int), 1, out);
-
-      /* Loop over all segments for this Track */
-      for (int s=0; s < num_segments; s++) {
-
-        /* Get data for this segment */
-        curr_segment = curr_track->getSegment(s);
-        length = curr_segment->_length;
-        material_id = curr_segment->_material->getId();
-        region_id = curr_segment->_region_id;
-
-        /* Write data for this segment to the Track file */
-        fwrite(&length, sizeof(double), 1, out);
-        fwrite(&material_id, sizeof(int), 1, out);
-        fwrite(&region_id, sizeof(int), 1, out);
-
-        /* Write CMFD-related data for the Track if needed */
-        if (cmfd != NULL) {
-          cmfd_surface_fwd = curr_segment->_cmfd_surface_fwd;
-          cmfd_surface_bwd = curr_segment->_cmfd_surface_bwd;
-          fwrite(&cmfd_surface_fwd, sizeof(int), 1, out);
-          fwrite(&cmfd_surface_bwd, sizeof(int), 1, out);
-        }
-      }
+      Track* curr_track = &_tracks[i][j];
+      track_file_track* track = &tracks[uid];
+      track->_start[0] = curr_track->getStart()->getX();
+      track->_start[1] = curr_track->getStart()->getY();
+      track->_start[2] = curr_track->getStart()->getZ();
+      track->_end[0] = curr_track->getEnd()->getX();
+      track->_end[1] = curr_track->getEnd()->getY();
+      track->_end[2] = curr_track->getEnd()->getZ();
+      track->_phi = curr_track->getPhi();
+      track->_azim_index = curr_track->getAzimAngleIndex();
+      track->_num_segments = track_offsets[uid+1] - track_offsets[uid];
+      uid++;
     }
   }
 
-  /* Get FSR vector maps */
-  ParallelHashMap<std::string, fsr_data*>& FSR_keys_map =
-      _geometry->getFSRKeysMap();
-  std::vector<std::string>& FSRs_to_keys = _geometry->getFSRsToKeys();
-  std::string fsr_key;
-  int fsr_id;
-  double x, y, z;
+  written &= writeTrackFileSection(out, &tracks[0], sizes[TRACK_FILE_TRACKS],
+                                   &checksum);
+  written &= writeTrackFileSection(out, track_offsets,
+                                   sizes[TRACK_FILE_TRACK_OFFSETS], &checksum);
+  std::vector<track_file_track>().swap(tracks);
+
+  /* Write the segment arrays */
+  written &= writeTrackFileSection(out, _segment_arrays._lengths,
+                                   sizes[TRACK_FILE_LENGTHS], &checksum);
+  written &= writeTrackFileSection(out, _segment_arrays._region_ids,
+                                   sizes[TRACK_FILE_REGION_IDS], &checksum);
+  written &= writeTrackFileSection(out, _segment_arrays._material_indices,
+                                   sizes[TRACK_FILE_MATERIAL_INDICES],
+                                   &checksum);
+  written &= writeTrackFileSection(out, _segment_arrays._cmfd_surfaces_fwd,
+                                   sizes[TRACK_FILE_CMFD_SURFACES_FWD],
+                                   &checksum);
+  written &= writeTrackFileSection(out, _segment_arrays._cmfd_surfaces_bwd,
+                                   sizes[TRACK_FILE_CMFD_SURFACES_BWD],
+                                   &checksum);
+
+  written &= writeTrackFileSection(out, material_ids.data(),
+                                   sizes[TRACK_FILE_MATERIAL_IDS], &checksum);
+
+  /* Write the characteristic point and key of each FSR */
+  std::vector<track_file_fsr> fsrs(num_FSRs);
 
-  /* Write number of FSRs */
-  int num_FSRs = _geometry->getNumFSRs();
-  fwrite(&num_FSRs, sizeof(int), 1, out);
+  for (int r=0; r < num_FSRs; r++) {
+    fsr_data* fsr = FSR_keys_map.at(FSRs_to_keys.at(r));
+    fsrs[r]._point[0] = fsr->_point->getX();
+    fsrs[r]._point[1] = fsr->_point->getY();
+    fsrs[r]._point[2] = fsr->_point->getZ();
+    fsrs[r]._fsr_id = fsr->_fsr_id;
+    fsrs[r]._cmfd_cell = (cmfd != NULL) ? fsr->_cmfd_cell : -1;
+  }
 
-  /* Write FSR vector maps to file */
-  std::string* fsr_key_list = FSR_keys_map.keys();
-  fsr_data** fsr_data_list = FSR_keys_map.values();
-  for (int i=0; i < num_FSRs; i++) {
+  written &= writeTrackFileSection(out, fsrs.data(), sizes[TRACK_FILE_FSRS],
+                                   &checksum);
+  written &= writeTrackFileSection(out, FSRs_to_keys.data(),
+                                   sizes[TRACK_FILE_FSR_KEYS], &checksum);
+
+  /* Write the FSRs in each CMFD cell */
+  std::vector<long> cell_offsets;
+  std::vector<int> cell_fsr_ids;
 
-    /* Write key to file from FSR_keys_map */
-    fsr_key = fsr_key_list[i];
-    string_length = fsr_key.length() + 1;
-    fwrite(&string_length, sizeof(int), 1, out);
-    fwrite(fsr_key.c_str(), sizeof(char)*string_length, 1, out);
-
-    /* Write data to file from FSR_keys_map */
-    fsr_id = fsr_data_list[i]->_fsr_id;
-    x = fsr_data_list[i]->_point->getX();
-    y = fsr_data_list[i]->_point->getY();
-    z = fsr_data_list[i]->_point->getZ();
-    fwrite(&fsr_id, sizeof(int), 1, out);
-    fwrite(&x, sizeof(double), 1, out);
-    fwrite(&y, sizeof(double), 1, out);
-    fwrite(&z, sizeof(double), 1, out);
-
-    /* Write data to file from FSRs_to_keys */
-    fsr_key = FSRs_to_keys.at(i);
-    string_length = fsr_key.length() + 1;
-    fwrite(&string_length, sizeof(int), 1, out);
-    fwrite(fsr_key.c_str(), sizeof(char)*string_length, 1, out);
-  }
-
-  /* Write cmfd_fsrs vector of vectors to file */
   if (cmfd != NULL) {
-    std::vector< std::vector<int> >* cell_fsrs = cmfd->getCellFSRs();
-    std::vector<int>::iterator iter;
-    int num_cells = cmfd->getNumCells();
-    fwrite(&num_cells, sizeof(int), 1, out);
-
-    /* Loop over CMFD cells */
-    for (int cell=0; cell < num_cells; cell++) {
-      num_FSRs = cell_fsrs->at(cell).size();
-      fwrite(&num_FSRs, sizeof(int), 1, out);
-
-      /* Loop over FSRs within cell */
-      for (iter = cell_fsrs->at(cell).begin();
-           iter != cell_fsrs->at(cell).end(); ++iter)
-        fwrite(&(*iter), sizeof(int), 1, out);
+    for (int cell=0; cell < header._num_cmfd_cells; cell++) {
+      cell_offsets.push_back(cell_fsr_ids.size());
+      cell_fsr_ids.insert(cell_fsr_ids.end(), cell_fsrs->at(cell).begin(),
+                          cell_fsrs->at(cell).end());
     }
+    cell_offsets.push_back(cell_fsr_ids.size());
   }
 
-  /* Delete key and value lists */
-  delete [] fsr_key_list;
-  delete [] fsr_data_list;
-
-  /* Close the Track file */
-  fclose(out);
+  written &= writeTrackFileSection(out, cell_offsets.data(),
+                                   sizes[TRACK_FILE_CMFD_CELL_OFFSETS],
+                                   &checksum);
+  written &= writeTrackFileSection(out, cell_fsr_ids.data(),
+                                   sizes[TRACK_FILE_CMFD_CELL_FSRS], &checksum);
+
+  /* Overwrite the header with the checksum */
+  header._checksum = checksum;
+  written &= fseek(out, 0, SEEK_SET) == 0;
+  written &= fwrite(&header, sizeof(track_file_header), 1, out) == 1;
+  written &= fclose(out) == 0;
+
+  if (!written || rename(temp_filename.c_str(), _tracks_filename.c_str())) {
+    log_printf(WARNING, "Unable to write the Track file %s",
+               _tracks_filename.c_str());
+    remove(temp_filename.c_str());
+    return;
+  }
 
   /* Inform other the TrackGenerator::generateTracks() method that it may
    * import ray tracing data from this file if it is called and the ray
@@ -1512,200 +2004,197 @@ void TrackGenerator::dumpTracksToFile() {
 
 
 /**
- * @brief Reads Tracks in from a "*.tracks" binary file.
+ * @brief Reads Tracks in from a binary Track file.
  * @details Storing Tracks in a binary file saves time by eliminating ray
  *          tracing for Track segmentation in commonly simulated geometries.
+ *          The Track file is memory mapped and is only used if its version,
+ *          floating point precision and geometry hash match and its
+ *          checksum is correct. The segment arrays point into the private
+ *          mapping, which remains until the segments are split, and are
+ *          the only copy of the segments, as for ray traced Tracks.
  * @return true if able to read Tracks in from a file; false otherwise
  */
 bool TrackGenerator::readTracksFromFile() {
 
-  /* Deletes Tracks arrays if tracks have been generated */
-  if (_contains_tracks) {
-    delete [] _num_tracks;
-    delete [] _num_x;
-    delete [] _num_y;
-
-    for (int i = 0; i < _num_azim_2; i++)
-      delete [] _tracks[i];
+  /* Map the Track file into memory */
+  int fd = open(_tracks_filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
 
-    delete [] _tracks;
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 ||
+      file_stat.st_size < (off_t) sizeof(track_file_header)) {
+    close(fd);
+    log_printf(NORMAL, "Regenerating Tracks since the Track file %s is not a "
+               "valid Track file", _tracks_filename.c_str());
+    return false;
   }
 
-  int ret;
-  FILE* in;
-  in = fopen(_tracks_filename.c_str(), "r");
-  int string_length;
+  long file_size = file_stat.st_size;
+  char* map = (char*) mmap(NULL, file_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE, fd, 0);
+  close(fd);
 
-  /* Import Geometry metadata from the Track file */
-  ret = fread(&string_length, sizeof(int), 1, in);
-  char* geometry_to_string = new char[string_length];
-  ret = fread(geometry_to_string, sizeof(char)*string_length, 1, in);
-
-  /* Check if our Geometry is exactly the same as the Geometry in the
-   * Track file for this number of azimuthal angles and track spacing */
-  if (_geometry->toString().compare(std::string(geometry_to_string)) != 0)
+  if (map == MAP_FAILED) {
+    log_printf(NORMAL, "Regenerating Tracks since the Track file %s could "
+               "not be mapped", _tracks_filename.c_str());
     return false;
+  }
 
-  delete [] geometry_to_string;
+  /* Check that the Track file was written for this Geometry and layout */
+  track_file_header* header = (track_file_header*) map;
+  Cmfd* cmfd = _geometry->getCmfd();
+  long sizes[NUM_TRACK_FILE_SECTIONS];
+  long offsets[NUM_TRACK_FILE_SECTIONS];
+  const char* problem = NULL;
+
+  if (strncmp(header->_magic, TRACK_FILE_MAGIC, sizeof(header->_magic)) != 0)
+    problem = "is not a valid Track file";
+  else if (header->_version != TRACK_FILE_VERSION)
+    problem = "was written with a different version";
+  else if (header->_fp_precision != sizeof(FP_PRECISION))
+    problem = "was written with a different floating point precision";
+  else if (header->_geometry_hash != hashGeometry())
+    problem = "was written for a different Geometry";
+  else if (header->_num_azim != 2 * _num_azim_2 ||
+           (header->_contains_cmfd != 0) != (cmfd != NULL))
+    problem = "was written for different ray tracing parameters";
+  else if (header->_num_tracks < 0 || header->_num_segments < 0 ||
+           header->_num_materials < 0 || header->_num_FSRs < 0 ||
+           header->_num_cmfd_cells < 0 || header->_num_cmfd_cell_fsrs < 0 ||
+           layoutTrackFile(header, sizes, offsets) != file_size ||
+           header->_file_size != file_size ||
+           !std::equal(offsets, offsets + NUM_TRACK_FILE_SECTIONS,
+                       header->_offsets))
+    problem = "is truncated";
+  else if (hashWords(14695981039346656037ULL, map + offsets[0],
+                     file_size - offsets[0]) != header->_checksum)
+    problem = "is corrupt";
+
+  /* Find the Materials referenced by the segments */
+  std::map<int, Material*> materials = _geometry->getAllMaterials();
+  int* material_ids = (int*) (map + header->_offsets[TRACK_FILE_MATERIAL_IDS]);
+  Material** segment_materials = NULL;
+
+  if (problem == NULL) {
+    segment_materials = new Material*[header->_num_materials];
+    for (int m=0; m < header->_num_materials; m++) {
+      if (materials.count(material_ids[m]) == 0) {
+        problem = "references Materials which are not in the Geometry";
+        break;
+      }
+      segment_materials[m] = materials[material_ids[m]];
+    }
+  }
+
+  if (problem != NULL) {
+    log_printf(NORMAL, "Regenerating Tracks since the Track file %s %s",
+               _tracks_filename.c_str(), problem);
+    delete [] segment_materials;
+    munmap(map, file_size);
+    return false;
+  }
 
   log_printf(NORMAL, "Importing ray tracing data from file...");
 
   /* Import ray tracing metadata from the Track file */
-  int num_azim;
-  ret = fread(&num_azim, sizeof(int), 1, in);
-  _num_azim_2 = num_azim/2;
-  ret = fread(&_azim_spacing, sizeof(double), 1, in);
+  _num_azim_2 = header->_num_azim / 2;
+  _azim_spacing = header->_azim_spacing;
 
-  /* Initialize data structures for Tracks */
   _num_tracks = new int[_num_azim_2];
   _num_x = new int[_num_azim_2];
   _num_y = new int[_num_azim_2];
   _tracks = new Track*[_num_azim_2];
 
-  ret = fread(_num_tracks, sizeof(int), _num_azim_2, in);
-  ret = fread(_num_x, sizeof(int), _num_azim_2, in);
-  ret = fread(_num_y, sizeof(int), _num_azim_2, in);
-
-  Track* curr_track;
-  double x0, y0, z0, x1, y1, z1;
-  double phi;
-  int azim_angle_index;
-  int num_segments;
-  Cmfd* cmfd = _geometry->getCmfd();
-
-  double length;
-  int material_id;
-  int region_id;
-
-  int cmfd_surface_fwd;
-  int cmfd_surface_bwd;
-  segment curr_segment;
-
-  std::map<int, Material*> materials = _geometry->getAllMaterials();
+  memcpy(_num_tracks, map + offsets[TRACK_FILE_NUM_TRACKS],
+         sizes[TRACK_FILE_NUM_TRACKS]);
+  memcpy(_num_x, map + offsets[TRACK_FILE_NUM_X], sizes[TRACK_FILE_NUM_X]);
+  memcpy(_num_y, map + offsets[TRACK_FILE_NUM_Y], sizes[TRACK_FILE_NUM_Y]);
+
+  track_file_track* tracks =
+       (track_file_track*) (map + offsets[TRACK_FILE_TRACKS]);
+  long* track_offsets = (long*) (map + offsets[TRACK_FILE_TRACK_OFFSETS]);
+  FP_PRECISION* lengths = (FP_PRECISION*) (map + offsets[TRACK_FILE_LENGTHS]);
+  int* region_ids = (int*) (map + offsets[TRACK_FILE_REGION_IDS]);
+  int* material_indices = (int*) (map + offsets[TRACK_FILE_MATERIAL_INDICES]);
+  int* cmfd_surfaces_fwd =
+       (int*) (map + offsets[TRACK_FILE_CMFD_SURFACES_FWD]);
+  int* cmfd_surfaces_bwd =
+       (int*) (map + offsets[TRACK_FILE_CMFD_SURFACES_BWD]);
+
+  /* Initialize each Track with its end points and angle */
+  int uid = 0;
 
-  /* Loop over Tracks */
   for (int i=0; i < _num_azim_2; i++) {
     _tracks[i] = new Track[_num_tracks[i]];
 
     for (int j=0; j < _num_tracks[i]; j++) {
-
-      /* Import data for this Track from Track file */
-      ret = fread(&x0, sizeof(double), 1, in);
-      ret = fread(&y0, sizeof(double), 1, in);
-      ret = fread(&z0, sizeof(double), 1, in);
-      ret = fread(&x1, sizeof(double), 1, in);
-      ret = fread(&y1, sizeof(double), 1, in);
-      ret = fread(&z1, sizeof(double), 1, in);
-      ret = fread(&phi, sizeof(double), 1, in);
-      ret = fread(&azim_angle_index, sizeof(int), 1, in);
-      ret = fread(&num_segments, sizeof(int), 1, in);
-
-      /* Initialize a Track with this data */
-      curr_track = &_tracks[i][j];
-      curr_track->setValues(x0, y0, z0, x1, y1, z1, phi);
-      curr_track->setAzimAngleIndex(azim_angle_index);
-      if (azim_angle_index < _num_azim_2 / 2)
-        _quadrature->setPhi(phi, azim_angle_index);
-
-      /* Loop over all segments in this Track */
-      for (int s=0; s < num_segments; s++) {
-
-        /* Import data for this segment from Track file */
-        ret = fread(&length, sizeof(double), 1, in);
-        ret = fread(&material_id, sizeof(int), 1, in);
-        ret = fread(&region_id, sizeof(int), 1, in);
-
-        /* Initialize segment with the data */
-        curr_segment._length = length;
-        curr_segment._material = materials[material_id];
-        curr_segment._region_id = region_id;
-
-        /* Import CMFD-related data if needed */
-        if (cmfd != NULL) {
-          ret = fread(&cmfd_surface_fwd, sizeof(int), 1, in);
-          ret = fread(&cmfd_surface_bwd, sizeof(int), 1, in);
-          curr_segment._cmfd_surface_fwd = cmfd_surface_fwd;
-          curr_segment._cmfd_surface_bwd = cmfd_surface_bwd;
-        }
-
-        /* Add this segment to the Track */
-        curr_track->addSegment(&curr_segment);
-      }
+      track_file_track* track = &tracks[uid];
+      Track* curr_track = &_tracks[i][j];
+      curr_track->setValues(track->_start[0], track->_start[1],
+                            track->_start[2], track->_end[0], track->_end[1],
+                            track->_end[2], track->_phi);
+      curr_track->setAzimAngleIndex(track->_azim_index);
+      if (track->_azim_index < _num_azim_2 / 2)
+        _quadrature->setPhi(track->_phi, track->_azim_index);
+      uid++;
     }
   }
 
-  /* Create FSR vector maps */
-  ParallelHashMap<std::string, fsr_data*>& FSR_keys_map =
+  /* Create the FSR maps from the FSR table */
+  ParallelHashMap<fsr_key, fsr_data*>& FSR_keys_map =
       _geometry->getFSRKeysMap();
-  std::vector<std::string>& FSRs_to_keys =
-      _geometry->getFSRsToKeys();
+  std::vector<fsr_key>& FSRs_to_keys = _geometry->getFSRsToKeys();
   FSR_keys_map.clear();
   FSRs_to_keys.clear();
-  int num_FSRs;
-  std::string fsr_key;
-  int fsr_key_id;
-  double x, y, z;
-
-  /* Get number of FSRs */
-  ret = fread(&num_FSRs, sizeof(int), 1, in);
-
-  /* Read FSR vector maps from file */
-  for (int fsr_id=0; fsr_id < num_FSRs; fsr_id++) {
-
-    /* Read key for FSR_keys_map */
-    ret = fread(&string_length, sizeof(int), 1, in);
-    char* char_buffer1 = new char[string_length];
-    ret = fread(char_buffer1, sizeof(char)*string_length, 1, in);
-    fsr_key = std::string(char_buffer1);
-
-    /* Read data from file for FSR_keys_map */
-    ret = fread(&fsr_key_id, sizeof(int), 1, in);
-    ret = fread(&x, sizeof(double), 1, in);
-    ret = fread(&y, sizeof(double), 1, in);
-    ret = fread(&z, sizeof(double), 1, in);
+
+  track_file_fsr* fsrs = (track_file_fsr*) (map + offsets[TRACK_FILE_FSRS]);
+  fsr_key* fsr_keys = (fsr_key*) (map + offsets[TRACK_FILE_FSR_KEYS]);
+
+  for (int r=0; r < header->_num_FSRs; r++) {
     fsr_data* fsr = new fsr_data;
-    fsr->_fsr_id = fsr_key_id;
+    fsr->_fsr_id = fsrs[r]._fsr_id;
+    fsr->_cmfd_cell = fsrs[r]._cmfd_cell;
     Point* point = new Point();
-    point->setCoords(x,y,z);
+    point->setCoords(fsrs[r]._point[0], fsrs[r]._point[1], fsrs[r]._point[2]);
     fsr->_point = point;
-    FSR_keys_map.insert(fsr_key, fsr);
-
-    /* Read data from file for FSR_to_keys */
-    ret = fread(&string_length, sizeof(int), 1, in);
-    char* char_buffer2 = new char[string_length];
-    ret = fread(char_buffer2, sizeof(char)*string_length, 1, in);
-    fsr_key = std::string(char_buffer2);
-    FSRs_to_keys.push_back(fsr_key);
+    FSR_keys_map.insert(fsr_keys[r], fsr);
+    FSRs_to_keys.push_back(fsr_keys[r]);
   }
 
-  /* Read cmfd cell_fsrs vector of vectors from file */
+  /* Index the FSRs for lookups by key and by FSR ID */
+  _geometry->initializeFSRIndex();
+
+  /* Set the FSRs in each CMFD cell */
   if (cmfd != NULL) {
-    std::vector< std::vector<int> > cell_fsrs;
-    int num_cells, fsr_id;
-    ret = fread(&num_cells, sizeof(int), 1, in);
-
-    /* Loop over CMFD cells */
-    for (int cell=0; cell < num_cells; cell++) {
-      cell_fsrs.push_back(std::vector<int>());
-      ret = fread(&num_FSRs, sizeof(int), 1, in);
-
-      /* Loop over FRSs within cell */
-      for (int fsr = 0; fsr < num_FSRs; fsr++) {
-        ret = fread(&fsr_id, sizeof(int), 1, in);
-        cell_fsrs.at(cell).push_back(fsr_id);
-      }
-    }
+    long* cell_offsets = (long*) (map + offsets[TRACK_FILE_CMFD_CELL_OFFSETS]);
+    int* cell_fsr_ids = (int*) (map + offsets[TRACK_FILE_CMFD_CELL_FSRS]);
+    std::vector< std::vector<int> > cell_fsrs(header->_num_cmfd_cells);
+
+    for (int cell=0; cell < header->_num_cmfd_cells; cell++)
+      cell_fsrs[cell].assign(cell_fsr_ids + cell_offsets[cell],
+                             cell_fsr_ids + cell_offsets[cell+1]);
 
-    /* Set CMFD cell_fsrs vector of vectors */
     cmfd->setCellFSRs(&cell_fsrs);
   }
 
-  /* Inform the rest of the class methods that Tracks have been initialized */
-  if (ret)
-    _contains_tracks = true;
+  /* Sweep the segments in place from the mapped Track file */
+  clearSegmentArrays();
+  _track_file_map = map;
+  _track_file_map_size = file_size;
+  _segment_arrays._num_segments = header->_num_segments;
+  _segment_arrays._track_offsets = track_offsets;
+  _segment_arrays._lengths = lengths;
+  _segment_arrays._region_ids = region_ids;
+  _segment_arrays._material_indices = material_indices;
+  _segment_arrays._cmfd_surfaces_fwd = cmfd_surfaces_fwd;
+  _segment_arrays._cmfd_surfaces_bwd = cmfd_surfaces_bwd;
+  _segment_arrays._num_materials = header->_num_materials;
+  _segment_arrays._materials = segment_materials;
 
-  /* Close the Track file */
-  fclose(in);
+  /* Inform the rest of the class methods that Tracks have been initialized */
+  _contains_tracks = true;
+  flattenCmfdCrossings();
 
   return true;
 }
@@ -1731,11 +2220,13 @@ void TrackGenerator::correctFSRVolume(int fsr_id, FP_PRECISION fsr_volume) {
   log_printf(INFO, "Correcting FSR %d volume from %f to %f",
              fsr_id, curr_volume, fsr_volume);
 
-  int num_segments, azim_index;
+  long* track_offsets = _segment_arrays._track_offsets;
+  FP_PRECISION* lengths = _segment_arrays._lengths;
+  int* region_ids = _segment_arrays._region_ids;
+  long first_segment, last_segment;
   double dx_eff, d_eff;
   double volume, corr_factor;
-  segment* curr_segment;
-  segment* segments;
+  int uid = 0;
 
   /* Correct volume separately for each azimuthal angle */
   for (int i=0; i < _num_azim_2; i++) {
@@ -1747,19 +2238,15 @@ void TrackGenerator::correctFSRVolume(int fsr_id, FP_PRECISION fsr_volume) {
     dx_eff = (_geometry->getWidthX() / _num_x[i]);
     d_eff = (dx_eff * sin(_tracks[i][0].getPhi()));
 
-    /* Compute the current estimated volume of the FSR for this angle */
-#pragma omp parallel for  private(num_segments, segments, curr_segment) \
-  reduction(+:volume)
-    for (int j=0; j < _num_tracks[i]; j++) {
-
-      num_segments = _tracks[i][j].getNumSegments();
-      segments = _tracks[i][j].getSegments();
+    /* The segments of the Tracks for this azimuthal angle */
+    first_segment = track_offsets[uid];
+    last_segment = track_offsets[uid + _num_tracks[i]];
 
-      for (int s=0; s < num_segments; s++) {
-        curr_segment = &segments[s];
-        if (curr_segment->_region_id == fsr_id)
-          volume += curr_segment->_length * d_eff;
-      }
+    /* Compute the current estimated volume of the FSR for this angle */
+#pragma omp parallel for reduction(+:volume)
+    for (long s=first_segment; s < last_segment; s++) {
+      if (region_ids[s] == fsr_id)
+        volume += lengths[s] * d_eff;
     }
 
     /* Compute correction factor to the volume */
@@ -1769,18 +2256,13 @@ void TrackGenerator::correctFSRVolume(int fsr_id, FP_PRECISION fsr_volume) {
                "angle %d is %f", fsr_id, i, corr_factor);
 
     /* Correct the length of each segment which crosses the FSR */
-#pragma omp parallel for  private(num_segments, segments, curr_segment)
-    for (int j=0; j < _num_tracks[i]; j++) {
-
-      num_segments = _tracks[i][j].getNumSegments();
-      segments = _tracks[i][j].getSegments();
-
-      for (int s=0; s < num_segments; s++) {
-        curr_segment = &segments[s];
-        if (curr_segment->_region_id == fsr_id)
-          curr_segment->_length *= corr_factor;
-      }
+#pragma omp parallel for
+    for (long s=first_segment; s < last_segment; s++) {
+      if (region_ids[s] == fsr_id)
+        lengths[s] *= corr_factor;
     }
+
+    uid += _num_tracks[i];
   }
 }
 
@@ -1806,6 +2288,11 @@ void TrackGenerator::generateFSRCentroids() {
     centroids[r]->setCoords(0.0, 0.0, 0.0);
   }
 
+  long* track_offsets = _segment_arrays._track_offsets;
+  FP_PRECISION* lengths = _segment_arrays._lengths;
+  int* region_ids = _segment_arrays._region_ids;
+  int uid = 0;
+
   /* Generate the fsr centroids */
   for (int i=0; i < _num_azim_2; i++) {
     FP_PRECISION azim_weight = _quadrature->getAzimWeight(i)
@@ -1814,36 +2301,37 @@ void TrackGenerator::generateFSRCentroids() {
 #pragma omp parallel for
     for (int j=0; j < _num_tracks[i]; j++) {
 
-      int num_segments = _tracks[i][j].getNumSegments();
-      segment* segments = _tracks[i][j].getSegments();
+      long first_segment = track_offsets[uid+j];
+      long last_segment = track_offsets[uid+j+1];
       double x = _tracks[i][j].getStart()->getX();
       double y = _tracks[i][j].getStart()->getY();
       double z = _tracks[i][j].getStart()->getZ();
       double phi = _tracks[i][j].getPhi();
 
-      for (int s=0; s < num_segments; s++) {
-        segment* curr_segment = &segments[s];
-        int fsr = curr_segment->_region_id;
-        double volume = FSR_volumes[fsr];
+      for (long s=first_segment; s < last_segment; s++) {
+        FP_PRECISION length = lengths[s];
+        int fsr = region_ids[s];
 
         /* Set FSR mutual exclusion lock */
         omp_set_lock(&_FSR_locks[fsr]);
 
         centroids[fsr]->setX(centroids[fsr]->getX() + azim_weight *
-                             (x + cos(phi) * curr_segment->_length / 2.0) *
-                             curr_segment->_length / FSR_volumes[fsr]);
+                             (x + cos(phi) * length / 2.0) *
+                             length / FSR_volumes[fsr]);
         centroids[fsr]->setY(centroids[fsr]->getY() + azim_weight *
-                             (y + sin(phi) * curr_segment->_length / 2.0) *
-                             curr_segment->_length / FSR_volumes[fsr]);
+                             (y + sin(phi) * length / 2.0) *
+                             length / FSR_volumes[fsr]);
         centroids[fsr]->setZ(z);
 
         /* Release FSR mutual exclusion lock */
         omp_unset_lock(&_FSR_locks[fsr]);
 
-        x += cos(phi) * curr_segment->_length;
-        y += sin(phi) * curr_segment->_length;
+        x += cos(phi) * length;
+        y += sin(phi) * length;
       }
     }
+
+    uid += _num_tracks[i];
   }
 
   /* Set the centroid for the FSR */
@@ -1861,7 +2349,13 @@ void TrackGenerator::generateFSRCentroids() {
  *        maximum optical length for the problem.
  * @details This routine is needed so that all segment lengths fit
  *          within the exponential interpolation table used in the MOC
- *          transport sweep.
+ *          transport sweep. The number of sub-segments of each Track is
+ *          counted first, and the segment arrays are only replaced if a
+ *          segment must be split, such that splitting the segments again
+ *          for the same optical length is cheap. The sub-segments of each
+ *          Track are then written to new segment arrays in parallel. This
+ *          works both for segments from ray tracing and for segments read
+ *          from a Track file.
  * @param max_optical_length the maximum optical length
  */
 void TrackGenerator::splitSegments(FP_PRECISION max_optical_length) {
@@ -1870,74 +2364,104 @@ void TrackGenerator::splitSegments(FP_PRECISION max_optical_length) {
     log_printf(ERROR, "Unable to split segments since "
 	       "tracks have not yet been generated");
 
-#pragma omp parallel
-  {
-
-    int num_cuts, min_num_cuts;
-    segment* curr_segment;
+  int num_tracks = getNumTracks();
+  std::vector<FP_PRECISION> max_sigma_t = getMaxSigmaT(&_segment_arrays);
+  long* track_offsets = _segment_arrays._track_offsets;
+  FP_PRECISION* lengths = _segment_arrays._lengths;
+  int* region_ids = _segment_arrays._region_ids;
+  int* material_indices = _segment_arrays._material_indices;
+  int* cmfd_surfaces_fwd = _segment_arrays._cmfd_surfaces_fwd;
+  int* cmfd_surfaces_bwd = _segment_arrays._cmfd_surfaces_bwd;
+
+  /* Count the sub-segments of each Track */
+  long* split_offsets = new long[num_tracks+1];
+  bool split = false;
+
+#pragma omp parallel for schedule(guided) reduction(||:split)
+  for (int t=0; t < num_tracks; t++) {
+
+    long num_split_segments = 0;
+    for (long s=track_offsets[t]; s < track_offsets[t+1]; s++) {
+      FP_PRECISION tau = lengths[s] * max_sigma_t[material_indices[s]];
+      num_split_segments += std::max(1, (int) ceil(tau / max_optical_length));
+    }
 
-    FP_PRECISION length, tau;
-    int fsr_id;
-    Material* material;
-    FP_PRECISION* sigma_t;
-    int num_groups;
-    int cmfd_surface_fwd, cmfd_surface_bwd;
+    split_offsets[t+1] = num_split_segments;
+    split = split || (num_split_segments != track_offsets[t+1] -
+                      track_offsets[t]);
+  }
 
-    /* Iterate over all Tracks */
-    for (int i=0; i < _num_azim_2; i++) {
-#pragma omp for
-      for (int j=0; j < _num_tracks[i]; j++) {
-        for (int s=0; s < _tracks[i][j].getNumSegments(); s+=min_num_cuts) {
-
-          /* Extract data from this segment to compute it optical length */
-          curr_segment = _tracks[i][j].getSegment(s);
-          material = curr_segment->_material;
-          length = curr_segment->_length;
-          fsr_id = curr_segment->_region_id;
-          cmfd_surface_fwd = curr_segment->_cmfd_surface_fwd;
-          cmfd_surface_bwd = curr_segment->_cmfd_surface_bwd;
-
-          /* Compute number of segments to split this segment into */
-          min_num_cuts = 1;
-          num_groups = material->getNumEnergyGroups();
-          sigma_t = material->getSigmaT();
-
-          for (int g=0; g < num_groups; g++) {
-            tau = length * sigma_t[g];
-            num_cuts = ceil(tau / max_optical_length);
-            min_num_cuts = std::max(num_cuts, min_num_cuts);
-          }
+  /* If no segment needs subdivisions, the segments are unchanged */
+  if (!split) {
+    delete [] split_offsets;
+    return;
+  }
 
-          /* If the segment does not need subdivisions, go to next segment */
-          if (min_num_cuts == 1)
-            continue;
+  split_offsets[0] = 0;
+  for (int t=0; t < num_tracks; t++)
+    split_offsets[t+1] += split_offsets[t];
+
+  long num_segments = split_offsets[num_tracks];
+  FP_PRECISION* split_lengths;
+  int* split_region_ids;
+  int* split_material_indices;
+  int* split_cmfd_surfaces_fwd;
+  int* split_cmfd_surfaces_bwd;
+
+  try {
+    split_lengths = new FP_PRECISION[num_segments];
+    split_region_ids = new int[num_segments];
+    split_material_indices = new int[num_segments];
+    split_cmfd_surfaces_fwd = new int[num_segments];
+    split_cmfd_surfaces_bwd = new int[num_segments];
+  }
+  catch (std::exception &e) {
+    log_printf(ERROR, "Unable to allocate memory for %ld split segments",
+               num_segments);
+  }
 
-          /* Split the segment into sub-segments */
-          for (int k=0; k < min_num_cuts; k++) {
+  /* Write the sub-segments of each Track from its start to its end */
+#pragma omp parallel for schedule(guided)
+  for (int t=0; t < num_tracks; t++) {
 
-            /* Create a new Track segment */
-            segment* new_segment = new segment;
-            new_segment->_material = material;
-            new_segment->_length = length / FP_PRECISION(min_num_cuts);
-            new_segment->_region_id = fsr_id;
+    long index = split_offsets[t];
 
-            /* Assign CMFD surface boundaries */
-            if (k == 0)
-              new_segment->_cmfd_surface_bwd = cmfd_surface_bwd;
+    for (long s=track_offsets[t]; s < track_offsets[t+1]; s++) {
 
-            if (k == min_num_cuts-1)
-              new_segment->_cmfd_surface_fwd = cmfd_surface_fwd;
+      FP_PRECISION tau = lengths[s] * max_sigma_t[material_indices[s]];
+      int num_cuts = std::max(1, (int) ceil(tau / max_optical_length));
+      FP_PRECISION length = lengths[s] / FP_PRECISION(num_cuts);
 
-            /* Insert the new segment to the Track */
-            _tracks[i][j].insertSegment(s+k+1, new_segment);
-          }
+      for (int k=0; k < num_cuts; k++) {
+        split_lengths[index] = length;
+        split_region_ids[index] = region_ids[s];
+        split_material_indices[index] = material_indices[s];
 
-          /* Remove the original segment from the Track */
-          _tracks[i][j].removeSegment(s);
-        }
+        /* Assign CMFD surface boundaries */
+        split_cmfd_surfaces_bwd[index] = (k == 0) ? cmfd_surfaces_bwd[s] : -1;
+        split_cmfd_surfaces_fwd[index] =
+             (k == num_cuts-1) ? cmfd_surfaces_fwd[s] : -1;
+        index++;
       }
     }
   }
+
+  /* Replace the segment arrays while keeping the indexed Materials */
+  Material** materials = _segment_arrays._materials;
+  int num_materials = _segment_arrays._num_materials;
+  _segment_arrays._materials = NULL;
+  clearSegmentArrays();
+
+  _segment_arrays._num_segments = num_segments;
+  _segment_arrays._track_offsets = split_offsets;
+  _segment_arrays._lengths = split_lengths;
+  _segment_arrays._region_ids = split_region_ids;
+  _segment_arrays._material_indices = split_material_indices;
+  _segment_arrays._cmfd_surfaces_fwd = split_cmfd_surfaces_fwd;
+  _segment_arrays._cmfd_surfaces_bwd = split_cmfd_surfaces_bwd;
+  _segment_arrays._num_materials = num_materials;
+  _segment_arrays._materials = materials;
+  flattenCmfdCrossings();
 }
 
 
@@ -1946,8 +2470,10 @@ void TrackGenerator::splitSegments(FP_PRECISION max_optical_length) {
  * @details This is called by the Solver at simulation time. This
  *          initialization is necessary since Materials in each FSR
  *          may be interchanged by the user in between different
- *          simulations. This method links each segment and fsr_data
- *          struct with the current Material found in each FSR.
+ *          simulations. This method links each fsr_data struct with the
+ *          current Material found in each FSR, and sets the Material
+ *          index of each segment from the Materials currently in the
+ *          Geometry.
  */
 void TrackGenerator::initializeSegments() {
 
@@ -1955,40 +2481,43 @@ void TrackGenerator::initializeSegments() {
     log_printf(ERROR, "Unable to initialize segments since "
 	       "tracks have not yet been generated");
 
-  /* Get all of the Materials from the Geometry */
-  std::map<int, Material*> materials = _geometry->getAllMaterials();
-
   /* Get the mappings of FSR to keys to fsr_data to update Materials */
-  ParallelHashMap<std::string, fsr_data*>& FSR_keys_map =
+  ParallelHashMap<fsr_key, fsr_data*>& FSR_keys_map =
       _geometry->getFSRKeysMap();
-  std::vector<std::string>& FSRs_to_keys = _geometry->getFSRsToKeys();
+  std::vector<fsr_key>& FSRs_to_keys = _geometry->getFSRsToKeys();
+  int num_FSRs = _geometry->getNumFSRs();
 
-#pragma omp parallel
-  {
+  /* The Solver may search the hash map with more threads than ray tracing */
+  FSR_keys_map.setNumThreads(omp_get_max_threads());
 
-    int region_id, mat_id;
-    segment* curr_segment;
-    Material* mat;
+  /* Set the Material for each FSR */
+#pragma omp parallel for
+  for (int r=0; r < num_FSRs; r++) {
+    Material* mat = _geometry->findFSRMaterial(r);
+    FSR_keys_map.at(FSRs_to_keys.at(r))->_mat_id = mat->getId();
+  }
 
-    /* Set the Material for each FSR */
-#pragma omp for
-    for (int r=0; r < _geometry->getNumFSRs(); r++) {
-      mat = _geometry->findFSRMaterial(r);
-      FSR_keys_map.at(FSRs_to_keys.at(r))->_mat_id = mat->getId();
-    }
+  /* Index the Materials currently in the Geometry */
+  std::map<int, int> material_indices;
+  indexSegmentMaterials(material_indices);
 
-    /* Set the Material for each segment */
-    for (int i=0; i < _num_azim_2; i++) {
-#pragma omp for
-      for (int j=0; j < _num_tracks[i]; j++) {
-        for (int s=0; s < _tracks[i][j].getNumSegments(); s++) {
-          curr_segment = _tracks[i][j].getSegment(s);
-          region_id = curr_segment->_region_id;
-          mat_id = FSR_keys_map.at(FSRs_to_keys.at(region_id))->_mat_id;
-          curr_segment->_material = materials[mat_id];
-        }
-      }
-    }
+  std::vector<int> fsr_material_indices(num_FSRs);
+  for (int r=0; r < num_FSRs; r++) {
+    int mat_id = FSR_keys_map.at(FSRs_to_keys.at(r))->_mat_id;
+    fsr_material_indices[r] = material_indices.at(mat_id);
+  }
+
+  /* Set the Material index of each segment. Segments mapped from a Track
+   * file are only written if their Material index changed, such that only
+   * those pages are copied on write. */
+  int* region_ids = _segment_arrays._region_ids;
+  int* segment_material_indices = _segment_arrays._material_indices;
+
+#pragma omp parallel for
+  for (long s=0; s < _segment_arrays._num_segments; s++) {
+    int index = fsr_material_indices[region_ids[s]];
+    if (segment_material_indices[s] != index)
+      segment_material_indices[s] = index;
   }
 }
 
@@ -2051,6 +2580,7 @@ void TrackGenerator::printTimerReport() {
  * @brief Resets the TrackGenerator to not contain tracks or segments
  */
 void TrackGenerator::resetStatus() {
+  clearSegmentArrays();
   _contains_tracks = false;
   _use_input_file = false;
   _tracks_filename = "";
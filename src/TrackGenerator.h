@@ -24,9 +24,179 @@
 #include <sstream>
 #include <unistd.h>
 #include <omp.h>
+#include <algorithm>
+#include <stdint.h>
 #endif
 
 
+/** The identifier at the start of each Track file */
+#define TRACK_FILE_MAGIC "OMOCTRK"
+
+/** The version of the Track file layout, which is incremented whenever
+ *  the layout changes so that out of date Track files are regenerated */
+#define TRACK_FILE_VERSION 3
+
+/** The alignment in bytes of each section of a Track file */
+#define TRACK_FILE_ALIGNMENT 64
+
+
+/**
+ * @enum trackFileSection
+ * @brief The sections of a Track file in the order they are stored.
+ */
+enum trackFileSection {
+
+  /** The number of Tracks for each azimuthal angle (int) */
+  TRACK_FILE_NUM_TRACKS,
+
+  /** The number of Tracks starting on the x-axis for each angle (int) */
+  TRACK_FILE_NUM_X,
+
+  /** The number of Tracks starting on the y-axis for each angle (int) */
+  TRACK_FILE_NUM_Y,
+
+  /** The end points and angle of each Track (track_file_track) */
+  TRACK_FILE_TRACKS,
+
+  /** The index of the first segment of each Track (long) */
+  TRACK_FILE_TRACK_OFFSETS,
+
+  /** The length of each segment (FP_PRECISION) */
+  TRACK_FILE_LENGTHS,
+
+  /** The FSR ID of each segment (int) */
+  TRACK_FILE_REGION_IDS,
+
+  /** The index into the Material IDs of each segment (int) */
+  TRACK_FILE_MATERIAL_INDICES,
+
+  /** The CMFD surface crossed by each segment's end point (int) */
+  TRACK_FILE_CMFD_SURFACES_FWD,
+
+  /** The CMFD surface crossed by each segment's start point (int) */
+  TRACK_FILE_CMFD_SURFACES_BWD,
+
+  /** The ID of each Material indexed by material index (int) */
+  TRACK_FILE_MATERIAL_IDS,
+
+  /** The characteristic point and CMFD cell of each FSR (track_file_fsr) */
+  TRACK_FILE_FSRS,
+
+  /** The key of each FSR (fsr_key) */
+  TRACK_FILE_FSR_KEYS,
+
+  /** The offset to the FSRs of each CMFD cell in the cell FSRs (long) */
+  TRACK_FILE_CMFD_CELL_OFFSETS,
+
+  /** The concatenated FSR IDs in each CMFD cell (int) */
+  TRACK_FILE_CMFD_CELL_FSRS,
+
+  /** The number of sections */
+  NUM_TRACK_FILE_SECTIONS
+};
+
+
+/**
+ * @struct track_file_header
+ * @brief The header at the start of a Track file.
+ * @details The header is followed by each trackFileSection in order, each
+ *          of which starts at a multiple of TRACK_FILE_ALIGNMENT bytes so
+ *          that a memory mapped Track file may be used in place. The
+ *          geometry hash identifies the Geometry for which the Tracks were
+ *          generated and the checksum covers all bytes after the header.
+ */
+struct track_file_header {
+
+  /** The TRACK_FILE_MAGIC identifier */
+  char _magic[8];
+
+  /** The TRACK_FILE_VERSION of the layout */
+  int _version;
+
+  /** The size in bytes of a segment length */
+  int _fp_precision;
+
+  /** A hash of the Geometry's string representation */
+  uint64_t _geometry_hash;
+
+  /** A checksum of all bytes after the header */
+  uint64_t _checksum;
+
+  /** The total size of the Track file in bytes */
+  int64_t _file_size;
+
+  /** The number of azimuthal angles in [0, 2pi] */
+  int _num_azim;
+
+  /** Whether the segments store the CMFD surfaces they cross */
+  int _contains_cmfd;
+
+  /** The azimuthal track spacing (cm) */
+  double _azim_spacing;
+
+  /** The total number of Tracks */
+  int _num_tracks;
+
+  /** The number of Materials referenced by the segments */
+  int _num_materials;
+
+  /** The total number of segments */
+  int64_t _num_segments;
+
+  /** The number of FSRs */
+  int _num_FSRs;
+
+  /** The number of CMFD cells */
+  int _num_cmfd_cells;
+
+  /** The total number of FSR IDs in all CMFD cells */
+  int64_t _num_cmfd_cell_fsrs;
+
+  /** The offset in bytes to each section from the start of the file */
+  int64_t _offsets[NUM_TRACK_FILE_SECTIONS];
+};
+
+
+/**
+ * @struct track_file_track
+ * @brief The end points and azimuthal angle of a Track in a Track file.
+ */
+struct track_file_track {
+
+  /** The x, y and z coordinates of the start point (cm) */
+  double _start[3];
+
+  /** The x, y and z coordinates of the end point (cm) */
+  double _end[3];
+
+  /** The azimuthal angle (radians) */
+  double _phi;
+
+  /** The azimuthal angle index */
+  int _azim_index;
+
+  /** The number of segments */
+  int _num_segments;
+};
+
+
+/**
+ * @struct track_file_fsr
+ * @brief The characteristic point and CMFD cell of an FSR in a Track file.
+ */
+struct track_file_fsr {
+
+  /** The x, y and z coordinates of the characteristic point (cm) */
+  double _point[3];
+
+  /** The ID of the FSR */
+  int _fsr_id;
+
+  /** The CMFD cell containing the FSR */
+  int _cmfd_cell;
+};
+
+
 /**
  * @class TrackGenerator TrackGenerator.h "src/TrackGenerator.h"
  * @brief The TrackGenerator is dedicated to generating and storing Tracks
@@ -103,6 +273,21 @@ protected:
   /** A buffer holding the computed FSR volumes */
   FP_PRECISION* _FSR_volumes;
 
+  /** The segments of all Tracks, which are released from each Track once
+   *  they are segmented */
+  segment_arrays _segment_arrays;
+
+  /** An array of Track pointers ordered by decreasing number of segments
+   *  used to schedule Tracks across threads, or NULL if it must be rebuilt */
+  Track** _track_schedule;
+
+  /** A private memory mapping of the Track file which the segment arrays
+   *  point into, or NULL if the segment arrays are on the heap */
+  char* _track_file_map;
+
+  /** The size in bytes of the Track file memory mapping */
+  long _track_file_map_size;
+
   void computeEndPoint(Point* start, Point* end,  const double phi,
                        const double width_x, const double width_y);
 
@@ -117,9 +302,14 @@ protected:
   void segmentize();
   void dumpTracksToFile();
   bool readTracksFromFile();
+  uint64_t hashGeometry();
   void clearTimerSplits();
   void calculateFSRVolumes();
   void resetStatus();
+  void flattenSegments();
+  void flattenCmfdCrossings();
+  void indexSegmentMaterials(std::map<int, int>& material_indices);
+  void clearSegmentArrays();
 
 public:
 
@@ -146,6 +336,8 @@ public:
   double getZCoord();
   omp_lock_t* getFSRLocks();
   segmentationType getSegmentFormation();
+  segment_arrays* getSegmentArrays();
+  Track** getTrackSchedule();
 
   /* Set parameters */
   void setNumAzim(int num_azim);
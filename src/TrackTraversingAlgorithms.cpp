@@ -23,7 +23,7 @@ void VolumeCalculator::execute() {
 #pragma omp parallel
   {
     VolumeKernel kernel(_track_generator);
-    loopOverTracks(&kernel);
+    loopOverTracksInline(this, &kernel);
   }
 }
 
@@ -36,6 +36,7 @@ void VolumeCalculator::execute() {
 TransportSweep::TransportSweep(TrackGenerator* track_generator)
                               : TraverseTracks(track_generator) {
   _cpu_solver = NULL;
+  _crossing_lists = false;
 
   /* Allocate temporary storage of FSR fluxes */
   int num_threads = omp_get_max_threads();
@@ -82,6 +83,7 @@ void TransportSweep::execute() {
  */
 void TransportSweep::setCPUSolver(CPUSolver* cpu_solver) {
   _cpu_solver = cpu_solver;
+  _crossing_lists = cpu_solver->isUsingCmfdCrossingLists();
 }
 
 
@@ -89,12 +91,12 @@ void TransportSweep::setCPUSolver(CPUSolver* cpu_solver) {
  * @brief Applies the MOC equations the Track and segments
  * @details The MOC equations are applied to each segment, attenuating the
  *          Track's angular flux and tallying FSR contributions. Finally,
- *          Track boundary fluxes are transferred.
+ *          Track boundary fluxes are transferred. The segments are read
+ *          directly from the segment arrays.
  * @param track The Track for which the angular flux is attenuated and
  *        transferred
- * @param segments The segments over which the MOC equations are applied
  */
-void TransportSweep::onTrack(Track* track, segment* segments) {
+void TransportSweep::onTrack(Track* track) {
 
   /* Get array for temporary scalar flux storage */
   int tid = omp_get_thread_num();
@@ -103,21 +105,53 @@ void TransportSweep::onTrack(Track* track, segment* segments) {
   /* Extract Track information */
   int track_id = track->getUid();
   int azim_index = track->getAzimAngleIndex();
-  int num_segments = track->getNumSegments();
   FP_PRECISION* track_flux;
 
-  /* Correct azimuthal index to first octant */
-  Quadrature* quad = _track_generator->getQuadrature();
+  /* Extract this Track's segments from the segment arrays */
+  long first_segment = _segment_arrays->_track_offsets[track_id];
+  long last_segment = _segment_arrays->_track_offsets[track_id+1];
+  FP_PRECISION* lengths = _segment_arrays->_lengths;
+  int* region_ids = _segment_arrays->_region_ids;
+  int* material_indices = _segment_arrays->_material_indices;
+  int* cmfd_surfaces_fwd = _segment_arrays->_cmfd_surfaces_fwd;
+  int* cmfd_surfaces_bwd = _segment_arrays->_cmfd_surfaces_bwd;
+  Material** materials = _segment_arrays->_materials;
 
   /* Get the forward track flux */
   track_flux = _cpu_solver->getBoundaryFlux(track_id, true);
 
   /* Loop over each Track segment in forward direction */
-  for (int s=0; s < num_segments; s++) {
-    segment* curr_segment = &segments[s];
-    _cpu_solver->tallyScalarFlux(curr_segment, azim_index, track_flux,
-                                 thread_fsr_flux);
-    _cpu_solver->tallyCurrent(curr_segment, azim_index, track_flux, true);
+  if (_crossing_lists) {
+
+    /* Sweep the runs of segments up to each CMFD surface crossing */
+    long c = _segment_arrays->_crossing_offsets_fwd[track_id];
+    long last_crossing = _segment_arrays->_crossing_offsets_fwd[track_id+1];
+    long* crossings = _segment_arrays->_crossings_fwd;
+    long s = first_segment;
+
+    while (true) {
+      long run_end = (c < last_crossing) ? crossings[c] + 1 : last_segment;
+      for (; s < run_end; s++)
+        _cpu_solver->tallyScalarFlux(s, lengths[s],
+                                     materials[material_indices[s]],
+                                     region_ids[s], azim_index, track_flux,
+                                     thread_fsr_flux);
+      if (c == last_crossing)
+        break;
+      _cpu_solver->tallyCurrent(cmfd_surfaces_fwd[crossings[c++]],
+                                azim_index, track_flux);
+    }
+  }
+  else {
+    for (long s=first_segment; s < last_segment; s++) {
+      _cpu_solver->tallyScalarFlux(s, lengths[s],
+                                   materials[material_indices[s]],
+                                   region_ids[s], azim_index, track_flux,
+                                   thread_fsr_flux);
+      if (cmfd_surfaces_fwd[s] != -1)
+        _cpu_solver->tallyCurrent(cmfd_surfaces_fwd[s], azim_index,
+                                  track_flux);
+    }
   }
 
   /* Transfer boundary angular flux to outgoing Track */
@@ -127,11 +161,37 @@ void TransportSweep::onTrack(Track* track, segment* segments) {
   track_flux = _cpu_solver->getBoundaryFlux(track_id, false);
 
   /* Loop over each Track segment in reverse direction */
-  for (int s=num_segments-1; s >= 0; s--) {
-    segment* curr_segment = &segments[s];
-    _cpu_solver->tallyScalarFlux(curr_segment, azim_index, track_flux,
-                                 thread_fsr_flux);
-    _cpu_solver->tallyCurrent(curr_segment, azim_index, track_flux, false);
+  if (_crossing_lists) {
+
+    /* Sweep the runs of segments down to each CMFD surface crossing */
+    long c = _segment_arrays->_crossing_offsets_bwd[track_id];
+    long last_crossing = _segment_arrays->_crossing_offsets_bwd[track_id+1];
+    long* crossings = _segment_arrays->_crossings_bwd;
+    long s = last_segment - 1;
+
+    while (true) {
+      long run_end = (c < last_crossing) ? crossings[c] : first_segment;
+      for (; s >= run_end; s--)
+        _cpu_solver->tallyScalarFlux(s, lengths[s],
+                                     materials[material_indices[s]],
+                                     region_ids[s], azim_index, track_flux,
+                                     thread_fsr_flux);
+      if (c == last_crossing)
+        break;
+      _cpu_solver->tallyCurrent(cmfd_surfaces_bwd[crossings[c++]],
+                                azim_index, track_flux);
+    }
+  }
+  else {
+    for (long s=last_segment-1; s >= first_segment; s--) {
+      _cpu_solver->tallyScalarFlux(s, lengths[s],
+                                   materials[material_indices[s]],
+                                   region_ids[s], azim_index, track_flux,
+                                   thread_fsr_flux);
+      if (cmfd_surfaces_bwd[s] != -1)
+        _cpu_solver->tallyCurrent(cmfd_surfaces_bwd[s], azim_index,
+                                  track_flux);
+    }
   }
 
   /* Transfer boundary angular flux to outgoing Track */
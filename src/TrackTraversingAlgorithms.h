@@ -33,9 +33,10 @@ class CPUSolver;
  * @details A VolumeCalculator imports a buffer to store FSR volumes from the
  *          provided TrackGenerator and the allocates VolumeKernels to
  *          calculate and update the volumes in each FSR, implicitly writing
- *          the calculated volumes back to the TrackGenerator.
+ *          the calculated volumes back to the TrackGenerator. The Tracks are
+ *          traversed with the VolumeKernel inlined into the segment loop.
  */
-class VolumeCalculator: public TraverseTracks {
+class VolumeCalculator final : public TraverseTracks {
 
 public:
 
@@ -52,13 +53,17 @@ public:
  *          using a provided CPUSolver, it applies the MOC equations to each
  *          segment, tallying the contributions to each FSR. At the end of each
  *          Track, boundary fluxes are exchanged based on boundary conditions.
+ *          Segments are read from the TrackGenerator's segment arrays. The
+ *          CPUSolver's operations are called virtually such that they may
+ *          be overridden by its subclasses.
  */
 class TransportSweep: public TraverseTracks {
 
-private:
+protected:
 
   CPUSolver* _cpu_solver;
   FP_PRECISION** _thread_fsr_fluxes;
+  bool _crossing_lists;
 
 public:
 
@@ -66,7 +71,7 @@ public:
   virtual ~TransportSweep();
   void setCPUSolver(CPUSolver* cpu_solver);
   void execute();
-  void onTrack(Track* track, segment* segments);
+  void onTrack(Track* track);
 };
 
 
@@ -11,6 +11,22 @@ TraverseTracks::TraverseTracks(TrackGenerator* track_generator) {
 
   /* Determine the type of segment formation used */
   _segment_formation = track_generator->getSegmentFormation();
+
+  /* Get the order in which Tracks are distributed to threads */
+  _track_schedule = track_generator->getTrackSchedule();
+
+  /* Get the segments of all Tracks */
+  _segment_arrays = track_generator->getSegmentArrays();
+
+  /* Allocate and zero the busy and idle times for each thread */
+  int num_threads = omp_get_max_threads();
+  _thread_busy_times = new double[num_threads];
+  _thread_idle_times = new double[num_threads];
+
+  for (int i=0; i < num_threads; i++) {
+    _thread_busy_times[i] = 0.;
+    _thread_idle_times[i] = 0.;
+  }
 }
 
 
@@ -18,6 +34,39 @@ TraverseTracks::TraverseTracks(TrackGenerator* track_generator) {
  * @brief Destructor for TraverseTracks
  */
 TraverseTracks::~TraverseTracks() {
+  delete [] _thread_busy_times;
+  delete [] _thread_idle_times;
+}
+
+
+/**
+ * @brief Returns the time a thread spent operating on Tracks.
+ * @param thread the OpenMP thread number
+ * @return the time the thread was busy (seconds)
+ */
+double TraverseTracks::getThreadBusyTime(int thread) {
+
+  if (thread < 0 || thread >= omp_get_max_threads())
+    log_printf(ERROR, "Unable to get the busy time for thread %d since "
+               "there are only %d threads", thread, omp_get_max_threads());
+
+  return _thread_busy_times[thread];
+}
+
+
+/**
+ * @brief Returns the time a thread spent waiting for the other threads to
+ *        finish operating on Tracks.
+ * @param thread the OpenMP thread number
+ * @return the time the thread was idle (seconds)
+ */
+double TraverseTracks::getThreadIdleTime(int thread) {
+
+  if (thread < 0 || thread >= omp_get_max_threads())
+    log_printf(ERROR, "Unable to get the idle time for thread %d since "
+               "there are only %d threads", thread, omp_get_max_threads());
+
+  return _thread_idle_times[thread];
 }
 
 
@@ -32,7 +81,7 @@ TraverseTracks::~TraverseTracks() {
 void TraverseTracks::loopOverTracks(MOCKernel* kernel) {
   switch (_segment_formation) {
     case EXPLICIT_2D:
-      loopOverTracks2D(kernel);
+      loopOverTracks2D(this, kernel);
       break;
     default:
       log_printf(ERROR, "Segment formation type not currently supported");
@@ -40,57 +89,8 @@ void TraverseTracks::loopOverTracks(MOCKernel* kernel) {
 }
 
 
-/**
- * @brief Loops over all explicit 2D Tracks
- * @details The onTrack(...) function is applied to all 2D Tracks and the
- *          specified kernel is applied to all segments. If NULL is provided
- *          for the kernel, only the onTrack(...) functionality is applied.
- * @param kernel The MOCKernel to apply to all segments
- */
-void TraverseTracks::loopOverTracks2D(MOCKernel* kernel) {
-
-  /* Loop over all parallel tracks for each azimuthal angle */
-  Track** tracks_2D = _track_generator->getTracks();
-  int num_azim = _track_generator->getNumAzim();
-  for (int a=0; a < num_azim/2; a++) {
-    int num_xy = _track_generator->getNumX(a) + _track_generator->getNumY(a);
-#pragma omp for
-    for (int i=0; i < num_xy; i++) {
-
-      Track* track_2D = &tracks_2D[a][i];
-
-      /* Apply the kernel to segments if necessary */
-      if (kernel != NULL) {
-        kernel->newTrack(track_2D);
-        traceSegmentsExplicit(track_2D, kernel);
-      }
-
-      /* Operate on the Track */
-      segment* segments = track_2D->getSegments();
-      onTrack(track_2D, segments);
-    }
-  }
-}
-
-
-/**
- * @brief Loops over segments in a Track when segments are explicitly generated
- * @details All segments in the provided Track are looped over and the provided
- *          MOCKernel is applied to them.
- * @param track The Track whose segments will be traversed
- * @param kernel The kernel to apply to all segments
- */
-void TraverseTracks::traceSegmentsExplicit(Track* track, MOCKernel* kernel) {
-  for (int s=0; s < track->getNumSegments(); s++) {
-    segment* seg = track->getSegment(s);
-    kernel->execute(seg->_length, seg->_material, seg->_region_id,
-                    seg->_cmfd_surface_fwd, seg->_cmfd_surface_bwd);
-  }
-}
-
-
 /**
  * @brief Dummy function for default onTrack implementation
  */
-void TraverseTracks::onTrack(Track* track, segment* segments) {
+void TraverseTracks::onTrack(Track* track) {
 }
@@ -31,16 +31,26 @@
  *          each Track and apply supplied MOCKernels to each segment. If NULL
  *          is provided for the MOCKernels, only the functionality defined in
  *          onTrack(...) is applied to each Track.
+ *
+ *          The loops are templated on the type of the traversal and of the
+ *          kernel. The loopOverTracks(...) method instantiates them with the
+ *          TraverseTracks and MOCKernel base classes such that onTrack(...)
+ *          and the kernel are called virtually. Subclasses which are declared
+ *          final may instead call loopOverTracksInline(...) with their own
+ *          type and a final kernel type such that the compiler resolves and
+ *          inlines these calls within the segment loop.
  */
 class TraverseTracks {
 
 private:
 
   /* Functions defining how to loop over Tracks */
-  void loopOverTracks2D(MOCKernel* kernel);
+  template <class TraversalType, class KernelType>
+  void loopOverTracks2D(TraversalType* traversal, KernelType* kernel);
 
   /* Functions defining how to traverse segments */
-  void traceSegmentsExplicit(Track* track, MOCKernel* kernel);
+  template <class KernelType>
+  void traceSegmentsExplicit(Track* track, KernelType* kernel);
 
 protected:
 
@@ -50,17 +60,130 @@ protected:
   /** The type of segmentation used for segment formation */
   segmentationType _segment_formation;
 
+  /** The Tracks ordered by decreasing number of segments */
+  Track** _track_schedule;
+
+  /** The segments of all Tracks */
+  segment_arrays* _segment_arrays;
+
+  /** The time each thread spent operating on Tracks (seconds) */
+  double* _thread_busy_times;
+
+  /** The time each thread spent waiting for other threads (seconds) */
+  double* _thread_idle_times;
+
   TraverseTracks(TrackGenerator* track_generator);
   virtual ~TraverseTracks();
 
   /* Functions defining how to loop over and operate on Tracks */
   void loopOverTracks(MOCKernel* kernel);
-  virtual void onTrack(Track* track, segment* segments);
+  virtual void onTrack(Track* track);
+
+  template <class TraversalType, class KernelType>
+  void loopOverTracksInline(TraversalType* traversal, KernelType* kernel);
 
 public:
 
   virtual void execute() = 0;
+  double getThreadBusyTime(int thread);
+  double getThreadIdleTime(int thread);
 
 };
 
+
+/**
+ * @brief Loops over Tracks, applying the provided kernel to all segments and
+ *        the functionality described in the traversal's onTrack(...) to all
+ *        Tracks with calls resolved at compile time.
+ * @details This method must be called from within an OpenMP parallel region.
+ *          If the traversal and kernel types are final classes, the calls to
+ *          onTrack(...) and to the kernel are not dispatched virtually.
+ * @param traversal a pointer to this object with the type of the subclass
+ * @param kernel The MOCKernel to apply to all segments
+ */
+template <class TraversalType, class KernelType>
+void TraverseTracks::loopOverTracksInline(TraversalType* traversal,
+                                          KernelType* kernel) {
+  switch (_segment_formation) {
+    case EXPLICIT_2D:
+      loopOverTracks2D(traversal, kernel);
+      break;
+    default:
+      log_printf(ERROR, "Segment formation type not currently supported");
+  }
+}
+
+
+/**
+ * @brief Loops over all explicit 2D Tracks
+ * @details The onTrack(...) function is applied to all 2D Tracks and the
+ *          specified kernel is applied to all segments. If NULL is provided
+ *          for the kernel, only the onTrack(...) functionality is applied.
+ *          The Tracks of all azimuthal angles are dynamically distributed to
+ *          threads with the Tracks with the most segments first, such that
+ *          threads only synchronize once all Tracks have been traversed. The
+ *          time each thread spends on Tracks and waiting for the other
+ *          threads is recorded.
+ * @param traversal a pointer to this object with the type of the subclass
+ * @param kernel The MOCKernel to apply to all segments
+ */
+template <class TraversalType, class KernelType>
+void TraverseTracks::loopOverTracks2D(TraversalType* traversal,
+                                      KernelType* kernel) {
+
+  int tid = omp_get_thread_num();
+  int num_tracks = _track_generator->getNumTracks();
+  double start_time = omp_get_wtime();
+
+  /* Loop over all tracks from the longest to the shortest */
+#pragma omp for schedule(dynamic) nowait
+  for (int i=0; i < num_tracks; i++) {
+
+    Track* track_2D = _track_schedule[i];
+
+    /* Apply the kernel to segments if necessary */
+    if (kernel != NULL) {
+      kernel->newTrack(track_2D);
+      traceSegmentsExplicit(track_2D, kernel);
+    }
+
+    /* Operate on the Track */
+    traversal->onTrack(track_2D);
+  }
+
+  /* Wait for all threads to finish their Tracks */
+  double busy_time = omp_get_wtime();
+#pragma omp barrier
+  double end_time = omp_get_wtime();
+
+  _thread_busy_times[tid] += busy_time - start_time;
+  _thread_idle_times[tid] += end_time - busy_time;
+}
+
+
+/**
+ * @brief Loops over segments in a Track when segments are explicitly generated
+ * @details All segments in the provided Track are looped over and the provided
+ *          MOCKernel is applied to them. The segments are read from the
+ *          TrackGenerator's segment arrays.
+ * @param track The Track whose segments will be traversed
+ * @param kernel The kernel to apply to all segments
+ */
+template <class KernelType>
+void TraverseTracks::traceSegmentsExplicit(Track* track, KernelType* kernel) {
+  int track_id = track->getUid();
+  long first_segment = _segment_arrays->_track_offsets[track_id];
+  long last_segment = _segment_arrays->_track_offsets[track_id+1];
+  FP_PRECISION* lengths = _segment_arrays->_lengths;
+  int* region_ids = _segment_arrays->_region_ids;
+  int* material_indices = _segment_arrays->_material_indices;
+  int* cmfd_surfaces_fwd = _segment_arrays->_cmfd_surfaces_fwd;
+  int* cmfd_surfaces_bwd = _segment_arrays->_cmfd_surfaces_bwd;
+  Material** materials = _segment_arrays->_materials;
+
+  for (long s=first_segment; s < last_segment; s++)
+    kernel->execute(lengths[s], materials[material_indices[s]], region_ids[s],
+                    cmfd_surfaces_fwd[s], cmfd_surfaces_bwd[s]);
+}
+
 #endif
@@ -69,6 +69,10 @@ Universe::Universe(const int id, const char* name) {
 
   /* By default, the Universe's fissionability is unknown */
   _fissionable = false;
+
+  /* The Cell index is built once the Geometry is complete */
+  _cell_grid_num_x = 0;
+  _cell_grid_num_y = 0;
 }
 
 
@@ -634,6 +638,8 @@ void Universe::addCell(Cell* cell) {
     log_printf(ERROR, "Unable to add Cell with ID = %d to Universe with"
                " ID = %d. Backtrace:\n%s", cell, _id, e.what());
   }
+
+  updateCellList();
 }
 
 
@@ -644,6 +650,254 @@ void Universe::addCell(Cell* cell) {
 void Universe::removeCell(Cell* cell) {
   if (_cells.find(cell->getId()) != _cells.end())
     _cells.erase(cell->getId());
+
+  updateCellList();
+}
+
+
+/**
+ * @brief Flattens the map of Cells into the list of Cells searched by
+ *        findCell().
+ * @details This method is called whenever a Cell is added to or removed
+ *          from the Universe. It discards the Cell index since the
+ *          bounding boxes no longer match the list of Cells.
+ */
+void Universe::updateCellList() {
+
+  _cell_list.clear();
+  std::transform(_cells.begin(), _cells.end(),
+                 std::back_inserter(_cell_list), pair_second(_cells));
+
+  clearCellIndex();
+}
+
+
+/**
+ * @brief Computes a bounding box which is guaranteed to contain a Region.
+ * @details The bounds reported by Region::getMinX() and its siblings are
+ *          those of an Intersection for every type of Region. This routine
+ *          instead takes the union of the bounds of a Union's nodes and
+ *          leaves Complements unbounded so that no Point in the Region can
+ *          lie outside of the box.
+ * @param region a pointer to the Region of interest
+ * @param bounds the min x, max x, min y and max y of the Region (output)
+ */
+static void boundRegion(Region* region, double* bounds) {
+
+  double inf = std::numeric_limits<double>::infinity();
+  bounds[0] = -inf;
+  bounds[1] = inf;
+  bounds[2] = -inf;
+  bounds[3] = inf;
+
+  if (region == NULL)
+    return;
+
+  regionType type = region->getRegionType();
+
+  if (type == HALFSPACE) {
+    bounds[0] = region->getMinX();
+    bounds[1] = region->getMaxX();
+    bounds[2] = region->getMinY();
+    bounds[3] = region->getMaxY();
+  }
+  else if (type == INTERSECTION || type == UNION) {
+
+    std::vector<Region*> nodes = region->getNodes();
+    if (nodes.size() == 0)
+      return;
+
+    /* Intersect the nodes' boxes, or start from an empty box for a Union */
+    if (type == UNION) {
+      bounds[0] = inf;
+      bounds[1] = -inf;
+      bounds[2] = inf;
+      bounds[3] = -inf;
+    }
+
+    double node_bounds[4];
+    std::vector<Region*>::iterator iter;
+    for (iter = nodes.begin(); iter != nodes.end(); ++iter) {
+      boundRegion(*iter, node_bounds);
+      if (type == INTERSECTION) {
+        bounds[0] = std::max(bounds[0], node_bounds[0]);
+        bounds[1] = std::min(bounds[1], node_bounds[1]);
+        bounds[2] = std::max(bounds[2], node_bounds[2]);
+        bounds[3] = std::min(bounds[3], node_bounds[3]);
+      }
+      else {
+        bounds[0] = std::min(bounds[0], node_bounds[0]);
+        bounds[1] = std::max(bounds[1], node_bounds[1]);
+        bounds[2] = std::min(bounds[2], node_bounds[2]);
+        bounds[3] = std::max(bounds[3], node_bounds[3]);
+      }
+    }
+  }
+}
+
+
+/**
+ * @brief Builds the index used by findCell() to cull Cells which cannot
+ *        contain a LocalCoords.
+ * @details The index stores a padded bounding box for each Cell. Universes
+ *          with more than CELL_GRID_MIN_CELLS Cells also overlay a uniform
+ *          grid on the finite extent of the boxes, with each bin listing the
+ *          Cells whose boxes overlap it, and list the neighbors of each Cell
+ *          whose boxes overlap its own. Cells are always tested in ascending
+ *          ID order so the index never changes which Cell is found. This
+ *          method is called for every Universe by Geometry::initializeFSRs()
+ *          once the Cells have been subdivided. The index is discarded when
+ *          a Cell is added or removed and must be rebuilt if the Surfaces of
+ *          the Universe's Cells are modified.
+ */
+void Universe::buildCellIndex() {
+
+  clearCellIndex();
+
+  int num_cells = _cell_list.size();
+  if (num_cells == 0)
+    return;
+
+  double inf = std::numeric_limits<double>::infinity();
+  double extent[4] = {inf, -inf, inf, -inf};
+
+  /* Compute the padded bounding box of each Cell and their finite extent */
+  _cell_bounds.resize(4 * num_cells);
+  for (int c=0; c < num_cells; c++) {
+
+    double* bounds = &_cell_bounds[4*c];
+    boundRegion(_cell_list[c]->getRegion(), bounds);
+
+    bounds[0] -= CELL_BOUNDS_PADDING;
+    bounds[1] += CELL_BOUNDS_PADDING;
+    bounds[2] -= CELL_BOUNDS_PADDING;
+    bounds[3] += CELL_BOUNDS_PADDING;
+
+    for (int i=0; i < 4; i++) {
+      if (bounds[i] != inf && bounds[i] != -inf) {
+        extent[i - i % 2] = std::min(extent[i - i % 2], bounds[i]);
+        extent[i - i % 2 + 1] = std::max(extent[i - i % 2 + 1], bounds[i]);
+      }
+    }
+  }
+
+  /* Only overlay a grid on Universes with many Cells and a finite extent */
+  if (num_cells <= CELL_GRID_MIN_CELLS || !(extent[1] > extent[0]) ||
+      !(extent[3] > extent[2]))
+    return;
+
+  int num_bins = std::min((int) std::ceil(sqrt(double(num_cells))),
+                          CELL_GRID_MAX_BINS);
+  _cell_grid_num_x = num_bins;
+  _cell_grid_num_y = num_bins;
+  _cell_grid_min[0] = extent[0];
+  _cell_grid_min[1] = extent[2];
+  _cell_grid_inv_width[0] = num_bins / (extent[1] - extent[0]);
+  _cell_grid_inv_width[1] = num_bins / (extent[3] - extent[2]);
+
+  /* Find the range of bins overlapped by each Cell's bounding box */
+  std::vector<int> bin_range(4 * num_cells);
+  for (int c=0; c < num_cells; c++) {
+    double* bounds = &_cell_bounds[4*c];
+    for (int d=0; d < 2; d++) {
+      double lo = (bounds[2*d] - _cell_grid_min[d]) * _cell_grid_inv_width[d];
+      double hi = (bounds[2*d+1] - _cell_grid_min[d]) *
+          _cell_grid_inv_width[d];
+      bin_range[4*c + 2*d] = std::max(0., std::min(floor(lo),
+                                                    num_bins - 1.));
+      bin_range[4*c + 2*d + 1] = std::max(0., std::min(floor(hi),
+                                                        num_bins - 1.));
+    }
+  }
+
+  /* Count the Cells in each bin and list them in ascending Cell order */
+  int num_grid_bins = _cell_grid_num_x * _cell_grid_num_y;
+  _cell_grid_offsets.assign(num_grid_bins + 1, 0);
+  for (int c=0; c < num_cells; c++)
+    for (int j=bin_range[4*c+2]; j <= bin_range[4*c+3]; j++)
+      for (int i=bin_range[4*c]; i <= bin_range[4*c+1]; i++)
+        _cell_grid_offsets[j * _cell_grid_num_x + i + 1]++;
+
+  for (int b=0; b < num_grid_bins; b++)
+    _cell_grid_offsets[b+1] += _cell_grid_offsets[b];
+
+  std::vector<int> fill(_cell_grid_offsets.begin(),
+                        _cell_grid_offsets.end() - 1);
+  _cell_grid_cells.resize(_cell_grid_offsets[num_grid_bins]);
+  for (int c=0; c < num_cells; c++)
+    for (int j=bin_range[4*c+2]; j <= bin_range[4*c+3]; j++)
+      for (int i=bin_range[4*c]; i <= bin_range[4*c+1]; i++)
+        _cell_grid_cells[fill[j * _cell_grid_num_x + i]++] = c;
+
+  /* List the neighbors of each Cell, which are those Cells whose bounding
+   * boxes overlap its own, found from the grid bins its box overlaps */
+  std::vector<int> last_seen(num_cells, -1);
+  _cell_neighbor_offsets.assign(num_cells + 1, 0);
+  for (int c=0; c < num_cells; c++) {
+
+    double* bounds = &_cell_bounds[4*c];
+    std::vector<int> neighbors;
+
+    for (int j=bin_range[4*c+2]; j <= bin_range[4*c+3]; j++) {
+      for (int i=bin_range[4*c]; i <= bin_range[4*c+1]; i++) {
+        int bin = j * _cell_grid_num_x + i;
+        for (int k=_cell_grid_offsets[bin]; k < _cell_grid_offsets[bin+1];
+             k++) {
+          int n = _cell_grid_cells[k];
+          if (n == c || last_seen[n] == c)
+            continue;
+          last_seen[n] = c;
+
+          double* n_bounds = &_cell_bounds[4*n];
+          if (n_bounds[0] <= bounds[1] && bounds[0] <= n_bounds[1] &&
+              n_bounds[2] <= bounds[3] && bounds[2] <= n_bounds[3])
+            neighbors.push_back(n);
+        }
+      }
+    }
+
+    std::sort(neighbors.begin(), neighbors.end());
+    _cell_neighbors.insert(_cell_neighbors.end(), neighbors.begin(),
+                           neighbors.end());
+    _cell_neighbor_offsets[c+1] = _cell_neighbors.size();
+  }
+
+  log_printf(DEBUG, "Built a %d x %d Cell grid for Universe ID = %d with %d "
+             "Cells and %d neighbors", _cell_grid_num_x, _cell_grid_num_y,
+             _id, num_cells, (int) _cell_neighbors.size());
+}
+
+
+/**
+ * @brief Discards the Cell bounding boxes and grid so that findCell()
+ *        tests every Cell in the Universe.
+ */
+void Universe::clearCellIndex() {
+  _cell_bounds.clear();
+  _cell_grid_offsets.clear();
+  _cell_grid_cells.clear();
+  _cell_neighbor_offsets.clear();
+  _cell_neighbors.clear();
+  _cell_grid_num_x = 0;
+  _cell_grid_num_y = 0;
+}
+
+
+/**
+ * @brief Returns the bin of the Cell grid containing a point.
+ * @param x the x-coordinate of the point
+ * @param y the y-coordinate of the point
+ * @return the grid bin, or -1 if the point is outside the grid
+ */
+inline int Universe::getCellGridBin(double x, double y) {
+
+  double i = floor((x - _cell_grid_min[0]) * _cell_grid_inv_width[0]);
+  double j = floor((y - _cell_grid_min[1]) * _cell_grid_inv_width[1]);
+
+  if (!(i >= 0 && i < _cell_grid_num_x && j >= 0 && j < _cell_grid_num_y))
+    return -1;
+
+  return int(j) * _cell_grid_num_x + int(i);
 }
 
 
@@ -668,88 +922,196 @@ bool Universe::containsPoint(Point* point) {
 }
 
 
+/**
+ * @brief Returns the index of a Cell in the flattened list of Cells.
+ * @param cell a pointer to the Cell of interest
+ * @return the index of the Cell, or -1 if it is not in this Universe
+ */
+int Universe::getCellIndex(Cell* cell) {
+
+  int id = cell->getId();
+  int lo = 0;
+  int hi = _cell_list.size();
+
+  /* Binary search the list of Cells, which is in ascending ID order */
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (_cell_list[mid]->getId() < id)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  if (lo < (int) _cell_list.size() && _cell_list[lo] == cell)
+    return lo;
+  else
+    return -1;
+}
+
+
+/**
+ * @brief Determines whether a Cell in the flattened list of Cells is filled
+ *        and contains a LocalCoords.
+ * @details The Cell's bounding box is checked first if the Cell index is
+ *          built.
+ * @param cell_index the index of the Cell in the flattened list of Cells
+ * @param coords a pointer to the LocalCoords of interest
+ * @param strict whether the LocalCoords must also not be on a Surface of
+ *        the Cell
+ * @return true if the Cell contains the LocalCoords; otherwise false
+ */
+inline bool Universe::cellContains(int cell_index, LocalCoords* coords,
+                                   bool strict) {
+
+  if (!_cell_bounds.empty()) {
+    const double* bounds = &_cell_bounds[4*cell_index];
+    double x = coords->getX();
+    double y = coords->getY();
+    if (x < bounds[0] || x > bounds[1] || y < bounds[2] || y > bounds[3])
+      return false;
+  }
+
+  Cell* cell = _cell_list[cell_index];
+  if (cell->getType() == UNFILLED)
+    return false;
+  else if (strict)
+    return cell->containsCoordsStrictly(coords);
+  else
+    return cell->containsCoords(coords);
+}
+
+
 /**
  * @brief Finds the Cell for which a LocalCoords object resides.
  * @details Finds the Cell that a LocalCoords object is located inside by
  *          checking each of this Universe's Cells. Returns NULL if the
- *          LocalCoords is not in any of the Cells.
+ *          LocalCoords is not in any of the Cells. The LocalCoords at lower
+ *          levels in the linked list are reused if present and any below
+ *          the Material-filled Cell which is found are deleted.
+ *
+ *          If the coords were moved a short distance along a Track from
+ *          where they were last found, the Cell they were previously in is
+ *          checked first. If the coords remain in it, the lower levels are
+ *          searched in the same way. Otherwise only the neighbors of the
+ *          previous Cell, or the Cells in the grid bin containing the
+ *          coords if fewer, are searched.
+ *
+ *          If the search is strict, the coords may have been moved any
+ *          distance. The previous Cell is only kept if the coords are
+ *          inside it and not on any of its Surfaces, and otherwise the
+ *          Cells are searched as if the coords were new. The Cell found is
+ *          then always the same as that found by a search from scratch.
  * @param coords a pointer to the LocalCoords of interest
+ * @param moved whether the coords were moved across at most one Surface,
+ *        or any distance if the search is strict, since they were last
+ *        found in a Cell of this Universe
+ * @param strict whether the previous Cell is only kept for coords which
+ *        are not on its Surfaces
  * @return a pointer the Cell where the LocalCoords is located
  */
-Cell* Universe::findCell(LocalCoords* coords) {
+Cell* Universe::findCell(LocalCoords* coords, bool moved, bool strict) {
 
-  Cell* cell;
-  std::vector<Cell*> cells;
-  std::vector<Cell*>::iterator iter;
+  Cell* cell = NULL;
+  bool same_cell = false;
 
   /* Sets the LocalCoord type to UNIV at this level */
   coords->setType(UNIV);
 
-  /* Add all of Universe's Cells to the back of neighbor Cells vector */
-  std::transform(_cells.begin(), _cells.end(),
-                 std::back_inserter(cells), pair_second(_cells));
+  /* Find the index of the Cell the coords were previously in */
+  int prev = -1;
+  if (moved && coords->getCell() != NULL)
+    prev = getCellIndex(coords->getCell());
 
-  /* Loop over all Cells */
-  for (iter = cells.begin(); iter != cells.end(); ++iter) {
-    cell = (*iter);
-
-    if (cell->containsCoords(coords)) {
-
-      /* Set the Cell on this level */
-      coords->setCell(cell);
-
-      /* MATERIAL type Cell - lowest level, terminate search for Cell */
-      if (cell->getType() == MATERIAL)
-        return cell;
-
-      /* FILL type Cell - Cell contains a Universe at a lower level
-       * Update coords to next level and continue search */
-      else if (cell->getType() == FILL) {
-
-        LocalCoords* next_coords =
-            new LocalCoords(coords->getX(), coords->getY(), coords->getZ());
-        next_coords->setPhi(coords->getPhi());
-
-        /* Apply translation to position in the next coords */
-	if (cell->isTranslated()){
-	  double* translation = cell->getTranslation();
-	  double new_x = coords->getX() + translation[0];
-	  double new_y = coords->getY() + translation[1];
-	  double new_z = coords->getZ() + translation[2];
-	  next_coords->setX(new_x);
-	  next_coords->setY(new_y);
-	  next_coords->setZ(new_z);
-	}
-
-        /* Apply rotation to position and direction in the next coords */
-	if (cell->isRotated()){
-	  double x = coords->getX();
-	  double y = coords->getY();
-	  double z = coords->getZ();
-	  double* matrix = cell->getRotationMatrix();
-	  double new_x = matrix[0] * x + matrix[1] * y + matrix[2] * z;
-	  double new_y = matrix[3] * x + matrix[4] * y + matrix[5] * z;
-	  double new_z = matrix[6] * x + matrix[7] * y + matrix[8] * z;
-	  next_coords->setX(new_x);
-	  next_coords->setY(new_y);
-	  next_coords->setZ(new_z);
-          next_coords->incrementPhi(cell->getPsi() * M_PI / 180.);
-	}
-
-        Universe* univ = cell->getFillUniverse();
-        next_coords->setUniverse(univ);
-
-        coords->setNext(next_coords);
-        next_coords->setPrev(coords);
-        if (univ->getType() == SIMPLE)
-          return univ->findCell(next_coords);
-        else
-          return static_cast<Lattice*>(univ)->findCell(next_coords);
+  /* Check whether the coords are still in the previous Cell */
+  if (prev >= 0 && cellContains(prev, coords, strict)) {
+    cell = _cell_list[prev];
+    same_cell = true;
+  }
+
+  else {
+
+    /* Narrow down the Cells to the previous Cell's neighbors or to those in
+     * the grid bin containing the coords, whichever are fewer */
+    int num_candidates = _cell_list.size();
+    const int* candidates = NULL;
+    if (prev >= 0 && !strict && !_cell_neighbor_offsets.empty()) {
+      candidates = _cell_neighbors.data() + _cell_neighbor_offsets[prev];
+      num_candidates = _cell_neighbor_offsets[prev+1] -
+          _cell_neighbor_offsets[prev];
+    }
+    if (_cell_grid_num_x > 0) {
+      int bin = getCellGridBin(coords->getX(), coords->getY());
+      if (bin >= 0 && _cell_grid_offsets[bin+1] - _cell_grid_offsets[bin]
+          < num_candidates) {
+        candidates = _cell_grid_cells.data() + _cell_grid_offsets[bin];
+        num_candidates = _cell_grid_offsets[bin+1] - _cell_grid_offsets[bin];
+      }
+    }
+
+    /* Loop over all candidate Cells */
+    for (int i=0; i < num_candidates; i++) {
+      int c = (candidates == NULL) ? i : candidates[i];
+      if ((c != prev || strict) && cellContains(c, coords)) {
+        cell = _cell_list[c];
+        break;
       }
     }
   }
 
-  return NULL;
+  if (cell == NULL)
+    return NULL;
+
+  /* Set the Cell on this level */
+  coords->setCell(cell);
+
+  /* MATERIAL type Cell - lowest level, terminate search for Cell */
+  if (cell->getType() == MATERIAL) {
+    if (coords->getNext() != NULL)
+      coords->prune();
+    return cell;
+  }
+
+  /* FILL type Cell - Cell contains a Universe at a lower level
+   * Update coords to next level and continue search */
+  LocalCoords* next_coords =
+      coords->getNextCreate(coords->getX(), coords->getY(), coords->getZ());
+  next_coords->setPhi(coords->getPhi());
+
+  /* Apply translation to position in the next coords */
+  if (cell->isTranslated()){
+    double* translation = cell->getTranslation();
+    double new_x = coords->getX() + translation[0];
+    double new_y = coords->getY() + translation[1];
+    double new_z = coords->getZ() + translation[2];
+    next_coords->setX(new_x);
+    next_coords->setY(new_y);
+    next_coords->setZ(new_z);
+  }
+
+  /* Apply rotation to position and direction in the next coords */
+  if (cell->isRotated()){
+    double x = coords->getX();
+    double y = coords->getY();
+    double z = coords->getZ();
+    double* matrix = cell->getRotationMatrix();
+    double new_x = matrix[0] * x + matrix[1] * y + matrix[2] * z;
+    double new_y = matrix[3] * x + matrix[4] * y + matrix[5] * z;
+    double new_z = matrix[6] * x + matrix[7] * y + matrix[8] * z;
+    next_coords->setX(new_x);
+    next_coords->setY(new_y);
+    next_coords->setZ(new_z);
+    next_coords->incrementPhi(cell->getPsi() * M_PI / 180.);
+  }
+
+  Universe* univ = cell->getFillUniverse();
+  next_coords->setUniverse(univ);
+
+  /* The lower levels moved the same short distance if the Cell is unchanged */
+  if (univ->getType() == SIMPLE)
+    return univ->findCell(next_coords, same_cell, strict);
+  else
+    return static_cast<Lattice*>(univ)->findCell(next_coords, same_cell,
+                                                 strict);
 }
 
 
@@ -1377,11 +1739,19 @@ bool Lattice::containsPoint(Point* point) {
  * @brief Finds the Cell within this Lattice that a LocalCoords is in.
  * @details This method first find the Lattice cell, then searches the
  *          Universe inside that Lattice cell. If LocalCoords is outside
- *          the bounds of the Lattice, this method will return NULL.
+ *          the bounds of the Lattice, this method will return NULL. If the
+ *          coords were moved a short distance and remain in the same Lattice
+ *          cell, the Universe inside it is told to check the Cell the coords
+ *          were previously in first.
  * @param coords the LocalCoords of interest
+ * @param moved whether the coords were moved across at most one Surface,
+ *        or any distance if the search is strict, since they were last
+ *        found in this Lattice
+ * @param strict whether the Cells the coords were previously in are only
+ *        kept for coords which are not on their Surfaces
  * @return a pointer to the Cell this LocalCoord is in or NULL
  */
-Cell* Lattice::findCell(LocalCoords* coords) {
+Cell* Lattice::findCell(LocalCoords* coords, bool moved, bool strict) {
 
   /* Set the LocalCoord to be a LAT type at this level */
   coords->setType(LAT);
@@ -1414,13 +1784,14 @@ Cell* Lattice::findCell(LocalCoords* coords) {
       (-_width_z*_num_z/2.0 + _offset.getZ() + (lat_z + 0.5) * _width_z) +
       getOffset()->getZ();
 
-  /* Create a new LocalCoords object for the next level Universe */
-  LocalCoords* next_coords;
+  /* The lower levels moved the same short distance if the coords remain in
+   * the same Lattice cell */
+  bool same_lattice_cell = moved && coords->getLattice() == this &&
+      coords->getLatticeX() == lat_x && coords->getLatticeY() == lat_y &&
+      coords->getLatticeZ() == lat_z;
 
-  if (coords->getNext() == NULL)
-    next_coords = new LocalCoords(next_x, next_y, next_z);
-  else
-    next_coords = coords->getNext();
+  /* Get or create the LocalCoords object for the next level Universe */
+  LocalCoords* next_coords = coords->getNextCreate(next_x, next_y, next_z);
 
   Universe* univ = getUniverse(lat_x, lat_y, lat_z);
   next_coords->setUniverse(univ);
@@ -1432,11 +1803,42 @@ Cell* Lattice::findCell(LocalCoords* coords) {
   coords->setLatticeY(lat_y);
   coords->setLatticeZ(lat_z);
 
-  coords->setNext(next_coords);
-  next_coords->setPrev(coords);
-
   /* Search the next lowest level Universe for the Cell */
-  return univ->findCell(next_coords);
+  return univ->findCell(next_coords, same_lattice_cell, strict);
+}
+
+
+/**
+ * @brief Computes the distance along a LocalCoords' trajectory to an x- or
+ *        y-plane.
+ * @details This performs the same arithmetic as Plane::intersection() and
+ *          Surface::getMinDistance() for the plane A x + B y = position.
+ * @param coords a pointer to the LocalCoords of interest
+ * @param A the x-coefficient of the plane (1 for an x-plane, else 0)
+ * @param B the y-coefficient of the plane (1 for a y-plane, else 0)
+ * @param position the location of the plane along its axis
+ * @return the distance to the plane, or INFINITY if it is not ahead
+ */
+static inline double distanceToPlane(LocalCoords* coords, double A, double B,
+                                     double position) {
+
+  double x0 = coords->getX();
+  double y0 = coords->getY();
+  double mx = cos(coords->getPhi());
+  double my = sin(coords->getPhi());
+
+  /* The track and plane are parallel */
+  if ((fabs(mx) < 1.e-10 && fabs(A) > 1.e-10) ||
+      (fabs(my) < 1.e-10 && fabs(B) > 1.e-10))
+    return INFINITY;
+
+  double l = - (A*x0 + B*y0 - position) / (A * mx + B * my);
+  if (l <= 0.0)
+    return INFINITY;
+
+  double delta_x = (x0 + l * mx) - x0;
+  double delta_y = (y0 + l * my) - y0;
+  return sqrt(delta_x*delta_x + delta_y*delta_y);
 }
 
 
@@ -1455,25 +1857,23 @@ double Lattice::minSurfaceDist(LocalCoords* coords) {
   int lat_y = getLatY(coords->getPoint());
   double phi = coords->getPhi();
 
-  /* Create planes representing the boundaries of the lattice cell */
-  XPlane xplane(0.0);
-  YPlane yplane(0.0);
+  /* Find the boundaries of the lattice cell in the direction of travel */
+  double plane_x, plane_y;
 
-  /* Get the min distance for X PLANE  */
   if (phi < M_PI_2)
-    xplane.setX(((lat_x+1) * _width_x - _width_x*_num_x/2.0 + _offset.getX()));
+    plane_x = (lat_x+1) * _width_x - _width_x*_num_x/2.0 + _offset.getX();
   else
-    xplane.setX((lat_x * _width_x - _width_x*_num_x/2.0 + _offset.getX()));
-
-  double dist_x = xplane.getMinDistance(coords);
+    plane_x = lat_x * _width_x - _width_x*_num_x/2.0 + _offset.getX();
 
-  /* Get the min distance for Y PLANE */
   if (phi < M_PI)
-    yplane.setY(((lat_y+1) * _width_y - _width_y*_num_y/2.0 + _offset.getY()));
+    plane_y = (lat_y+1) * _width_y - _width_y*_num_y/2.0 + _offset.getY();
   else
-    yplane.setY((lat_y * _width_y - _width_y*_num_y/2.0 + _offset.getY()));
+    plane_y = lat_y * _width_y - _width_y*_num_y/2.0 + _offset.getY();
 
-  double dist_y = yplane.getMinDistance(coords);
+  /* Get the min distances to the x and y planes without constructing
+   * Surfaces, which would allocate memory during ray tracing */
+  double dist_x = distanceToPlane(coords, 1., 0., plane_x);
+  double dist_y = distanceToPlane(coords, 0., 1., plane_y);
 
   /* return shortest distance to next lattice cell */
   return std::min(dist_x, dist_y);
@@ -77,6 +77,45 @@ protected:
   /** A collection of Cell IDs and Cell pointers in this Universe */
   std::map<int, Cell*> _cells;
 
+  /** The Cells in this Universe in ascending ID order, flattened from the
+   *  map of Cells so that findCell() need not copy the map */
+  std::vector<Cell*> _cell_list;
+
+  /** The bounding box (min x, max x, min y, max y) of each Cell in the
+   *  flattened list of Cells, or empty if the Cell index is not built */
+  std::vector<double> _cell_bounds;
+
+  /** The number of bins along x in the uniform grid over the Cells */
+  int _cell_grid_num_x;
+
+  /** The number of bins along y in the uniform grid over the Cells */
+  int _cell_grid_num_y;
+
+  /** The minimum x and y coordinates of the uniform grid over the Cells */
+  double _cell_grid_min[2];
+
+  /** The inverse widths along x and y of each bin in the uniform grid */
+  double _cell_grid_inv_width[2];
+
+  /** The offsets into the array of Cell indices for each grid bin */
+  std::vector<int> _cell_grid_offsets;
+
+  /** The indices of the Cells whose bounding boxes overlap each grid bin,
+   *  in ascending Cell ID order within each bin */
+  std::vector<int> _cell_grid_cells;
+
+  /** The offsets into the array of Cell neighbors for each Cell */
+  std::vector<int> _cell_neighbor_offsets;
+
+  /** The indices of the Cells whose bounding boxes overlap that of each
+   *  Cell, in ascending Cell ID order for each Cell */
+  std::vector<int> _cell_neighbors;
+
+  void updateCellList();
+  int getCellGridBin(double x, double y);
+  int getCellIndex(Cell* cell);
+  bool cellContains(int cell_index, LocalCoords* coords, bool strict=false);
+
   /** A boolean representing whether or not this Universe contains a Material
    *  with a non-zero fission cross-section and is fissionable */
   bool _fissionable;
@@ -114,7 +153,9 @@ public:
   void removeCell(Cell* cell);
 
   bool containsPoint(Point* point);
-  Cell* findCell(LocalCoords* coords);
+  Cell* findCell(LocalCoords* coords, bool moved=false, bool strict=false);
+  void buildCellIndex();
+  void clearCellIndex();
   void setFissionability(bool fissionable);
   void subdivideCells(double max_radius=INFINITY);
 
@@ -196,7 +237,7 @@ public:
   void subdivideCells(double max_radius=INFINITY);
 
   bool containsPoint(Point* point);
-  Cell* findCell(LocalCoords* coords);
+  Cell* findCell(LocalCoords* coords, bool moved=false, bool strict=false);
   double minSurfaceDist(LocalCoords* coords);
 
   int getLatX(Point* point);
@@ -1,6 +1,72 @@
 #include "VectorizedSolver.h"
 
 
+/**
+ * @brief Computes the exponential of a number with only arithmetic and
+ *        integer operations such that calls may be vectorized by the
+ *        compiler within OpenMP SIMD loops.
+ * @details The argument is reduced to \f$ x = n\ln(2) + r \f$ with
+ *          \f$ |r| \leq \ln(2)/2 \f$. The exponential of \f$ r \f$ is
+ *          approximated with the Cephes polynomial (single precision) or
+ *          Pade approximant (double precision), and is scaled by
+ *          \f$ 2^n \f$ by constructing the floating point exponent bits.
+ *          The argument is clamped to the range of normalized numbers.
+ * @param x the argument to the exponential
+ * @return the exponential of x
+ */
+#pragma omp declare simd
+static inline FP_PRECISION simd_exp(FP_PRECISION x) {
+
+#ifdef SINGLE
+  x = std::min(std::max(x, -87.0f), 88.0f);
+
+  /* Range reduction */
+  FP_PRECISION t = x * 1.44269504088896341f;
+  int n = (int)(t + (t < 0.f ? -0.5f : 0.5f));
+  FP_PRECISION r = x - n * 0.693359375f + n * 2.12194440e-4f;
+
+  /* Polynomial approximation to the exponential of the remainder */
+  FP_PRECISION y = 1.9875691500e-4f;
+  y = y * r + 1.3981999507e-3f;
+  y = y * r + 8.3334519073e-3f;
+  y = y * r + 4.1665795894e-2f;
+  y = y * r + 1.6666665459e-1f;
+  y = y * r + 5.0000001201e-1f;
+  y = y * r * r + r + 1.0f;
+
+  /* Multiply by two to the power of n */
+  int32_t bits = (int32_t)(n + 127) << 23;
+  FP_PRECISION scale;
+  memcpy(&scale, &bits, sizeof(scale));
+#else
+  x = std::min(std::max(x, -708.0), 709.0);
+
+  /* Range reduction */
+  FP_PRECISION t = x * 1.4426950408889634073599;
+  long n = (long)(t + (t < 0. ? -0.5 : 0.5));
+  FP_PRECISION r = x - n * 6.93145751953125e-1 - n * 1.42860682030941723212e-6;
+
+  /* Pade approximation to the exponential of the remainder */
+  FP_PRECISION rr = r * r;
+  FP_PRECISION p = r * ((1.26177193074810590878e-4 * rr +
+                         3.02994407707441961300e-2) * rr +
+                         9.99999999999999999910e-1);
+  FP_PRECISION q = ((3.00198505138664455042e-6 * rr +
+                     2.52448340349684104192e-3) * rr +
+                     2.27265548208155028766e-1) * rr +
+                     2.00000000000000000009e0;
+  FP_PRECISION y = 1.0 + 2.0 * p / (q - p);
+
+  /* Multiply by two to the power of n */
+  int64_t bits = (int64_t)(n + 1023) << 52;
+  FP_PRECISION scale;
+  memcpy(&scale, &bits, sizeof(scale));
+#endif
+
+  return y * scale;
+}
+
+
 /**
  * @brief Constructor initializes NULL arrays for source, flux, etc.
  * @param track_generator an optional pointer to a TrackGenerator object
@@ -8,17 +74,11 @@
 VectorizedSolver::VectorizedSolver(TrackGenerator* track_generator) :
   CPUSolver(track_generator) {
 
-  if (_cmfd != NULL)
-    log_printf(ERROR, "The VectorizedSolver is not yet configured for CMFD");
-
+  _num_vector_lengths = 1;
   _delta_psi = NULL;
   _thread_taus = NULL;
   _thread_exponentials = NULL;
-
-  if (track_generator != NULL)
-    setTrackGenerator(track_generator);
-
-  vmlSetMode(VML_EP);
+  _thread_fsr_fluxes = NULL;
 }
 
 
@@ -33,6 +93,16 @@ VectorizedSolver::~VectorizedSolver() {
     _boundary_flux = NULL;
   }
 
+  if (_start_flux != NULL) {
+    MM_FREE(_start_flux);
+    _start_flux = NULL;
+  }
+
+  if (_thread_vacuum_flux != NULL) {
+    MM_FREE(_thread_vacuum_flux);
+    _thread_vacuum_flux = NULL;
+  }
+
   if (_scalar_flux != NULL && !_user_fluxes) {
     MM_FREE(_scalar_flux);
     _scalar_flux = NULL;
@@ -67,6 +137,11 @@ VectorizedSolver::~VectorizedSolver() {
     MM_FREE(_thread_exponentials);
     _thread_exponentials = NULL;
   }
+
+  if (_thread_fsr_fluxes != NULL) {
+    MM_FREE(_thread_fsr_fluxes);
+    _thread_fsr_fluxes = NULL;
+  }
 }
 
 
@@ -83,24 +158,6 @@ int VectorizedSolver::getNumVectorWidths() {
 }
 
 
-/**
- * @brief Sets the Geometry for the Solver.
- * @param geometry a pointer to the Geometry
- */
-void VectorizedSolver::setGeometry(Geometry* geometry) {
-
-  CPUSolver::setGeometry(geometry);
-
-  /* Compute the number of SIMD vector widths needed to fit energy groups */
-  _num_vector_lengths = (_num_groups / VEC_LENGTH) + 1;
-
-  /* Reset the number of energy groups by rounding up for the number
-   * of vector widths needed to accomodate the energy groups */
-  _num_groups = _num_vector_lengths * VEC_LENGTH;
-  _polar_times_groups = _num_groups * _num_polar;
-}
-
-
 /**
  * @brief Allocates memory for the exponential linear interpolation table.
  */
@@ -113,10 +170,7 @@ void VectorizedSolver::initializeExpEvaluator() {
   if (_thread_exponentials != NULL)
     MM_FREE(_thread_exponentials);
 
-  /* Allocates memory for an array of exponential values for each thread
-   * - this is not used by default, but can be to allow for vectorized
-   * evaluation of the exponentials. Unfortunately this does not appear
-   * to give any performance boost. */
+  /* Allocates memory for an array of exponential values for each thread */
   int size = _num_threads * _polar_times_groups * sizeof(FP_PRECISION);
   _thread_exponentials = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
 }
@@ -143,7 +197,8 @@ void VectorizedSolver::initializeMaterials(solverMode mode) {
 /**
  * @brief Allocates memory for Track boundary angular and FSR scalar fluxes.
  * @details Deletes memory for old flux arrays if they were allocated for a
- *          previous simulation.
+ *          previous simulation. All arrays are aligned to VEC_ALIGNMENT
+ *          bytes and padded to a multiple of VEC_LENGTH energy groups.
  */
 void VectorizedSolver::initializeFluxArrays() {
 
@@ -151,6 +206,12 @@ void VectorizedSolver::initializeFluxArrays() {
   if (_boundary_flux != NULL)
     MM_FREE(_boundary_flux);
 
+  if (_start_flux != NULL)
+    MM_FREE(_start_flux);
+
+  if (_thread_vacuum_flux != NULL)
+    MM_FREE(_thread_vacuum_flux);
+
   if (_scalar_flux != NULL && !_user_fluxes)
     MM_FREE(_scalar_flux);
 
@@ -163,21 +224,35 @@ void VectorizedSolver::initializeFluxArrays() {
   if (_thread_taus != NULL)
     MM_FREE(_thread_taus);
 
-  int size;
+  if (_thread_fsr_fluxes != NULL)
+    MM_FREE(_thread_fsr_fluxes);
+
+  long size;
+
+  /* Only Track ends with reflective or periodic boundaries store fluxes */
+  initializeBoundaryFluxOffsets();
 
   /* Allocate aligned memory for all flux arrays */
   try{
 
-    size = 2 * _tot_num_tracks * _num_groups * _num_polar;
+    size = _num_boundary_fluxes * _polar_times_groups;
     size *= sizeof(FP_PRECISION);
     _boundary_flux = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+    _start_flux = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+
+    log_printf(INFO, "Boundary fluxes require %f MB of memory",
+               2 * size / 1.E6);
+
+    size = _num_threads * _polar_times_groups * sizeof(FP_PRECISION);
+    _thread_vacuum_flux = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
 
-    size = _num_FSRs * _num_groups * sizeof(FP_PRECISION);
+    size = (long)_num_FSRs * _num_groups * sizeof(FP_PRECISION);
     _scalar_flux = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
     _old_scalar_flux = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
 
     size = _num_threads * _num_groups * sizeof(FP_PRECISION);
     _delta_psi = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+    _thread_fsr_fluxes = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
 
     size = _num_threads * _polar_times_groups * sizeof(FP_PRECISION);
     _thread_taus = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
@@ -185,6 +260,10 @@ void VectorizedSolver::initializeFluxArrays() {
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the fluxes");
   }
+
+  _user_fluxes = false;
+
+  initializeFluxAccumulation();
 }
 
 
@@ -255,9 +334,14 @@ void VectorizedSolver::initializeFixedSources() {
 
 /**
  * @brief Initializes the FSR volumes and Materials array.
+ * @details The number of energy groups is padded to the number of SIMD
+ *          vector widths needed to fit the energy groups.
  */
 void VectorizedSolver::initializeFSRs() {
 
+  if (_geometry->getCmfd() != NULL)
+    log_printf(ERROR, "The VectorizedSolver is not yet configured for CMFD");
+
   CPUSolver::initializeFSRs();
 
   /* Compute the number of SIMD vector widths needed to fit energy groups */
@@ -266,11 +350,10 @@ void VectorizedSolver::initializeFSRs() {
   /* Reset the number of energy groups by rounding up for the number
    * of vector widths needed to accomodate the energy groups */
   _num_groups = _num_vector_lengths * VEC_LENGTH;
-  _polar_times_groups = _num_groups * _num_polar;
+  _polar_times_groups = _num_groups * _num_polar_2;
 }
 
 
-
 /**
  * @brief Normalizes all FSR scalar fluxes and Track boundary angular
  *        fluxes to the total fission source (times \f$ \nu \f$).
@@ -279,11 +362,11 @@ void VectorizedSolver::normalizeFluxes() {
 
   FP_PRECISION* nu_sigma_f;
   FP_PRECISION volume;
-  FP_PRECISION tot_fission_source;
+  double tot_fission_source;
   FP_PRECISION norm_factor;
 
-  int size = _num_FSRs * _num_groups * sizeof(FP_PRECISION);
-  FP_PRECISION* fission_sources = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+  long size = (long)_num_FSRs * _num_groups * sizeof(double);
+  double* fission_sources = (double*)MM_MALLOC(size, VEC_ALIGNMENT);
 
   /* Compute total fission source for each FSR, energy group */
 #pragma omp parallel for private(volume, nu_sigma_f) schedule(guided)
@@ -297,24 +380,15 @@ void VectorizedSolver::normalizeFluxes() {
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over each energy group within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
+#pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        fission_sources(r,e) = nu_sigma_f[e] * _scalar_flux(r,e);
-
-      /* Loop over each energy group within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        fission_sources(r,e) *= volume;
+        fission_sources(r,e) = nu_sigma_f[e] * _scalar_flux(r,e) * volume;
     }
   }
 
   /* Compute the total fission source */
-  size = _num_FSRs * _num_groups;
-#ifdef SINGLE
-  tot_fission_source = cblas_sasum(size, fission_sources, 1);
-#else
-  tot_fission_source = cblas_dasum(size, fission_sources, 1);
-#endif
+  size = (long)_num_FSRs * _num_groups;
+  tot_fission_source = pairwise_sum<double>(fission_sources, size);
 
   /* Deallocate memory for fission source array */
   MM_FREE(fission_sources);
@@ -326,24 +400,26 @@ void VectorizedSolver::normalizeFluxes() {
              tot_fission_source, norm_factor);
 
   /* Normalize the FSR scalar fluxes */
-#ifdef SINGLE
-  cblas_sscal(size, norm_factor, _scalar_flux, 1);
-  cblas_sscal(size, norm_factor, _old_scalar_flux, 1);
-#else
-  cblas_dscal(size, norm_factor, _scalar_flux, 1);
-  cblas_dscal(size, norm_factor, _old_scalar_flux, 1);
-#endif
+#pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+#pragma omp simd
+    for (int e=0; e < _num_groups; e++) {
+      _scalar_flux(r,e) *= norm_factor;
+      _old_scalar_flux(r,e) *= norm_factor;
+    }
+  }
 
   /* Normalize the Track angular boundary fluxes */
-  size = 2 * _tot_num_tracks * _num_polar * _num_groups;
-
-#ifdef SINGLE
-  cblas_sscal(size, norm_factor, _boundary_flux, 1);
-#else
-  cblas_dscal(size, norm_factor, _boundary_flux, 1);
-#endif
-
-  return;
+#pragma omp parallel for schedule(guided)
+  for (long b=0; b < _num_boundary_fluxes; b++) {
+    FP_PRECISION* boundary_flux = &_boundary_flux[b*_polar_times_groups];
+    FP_PRECISION* start_flux = &_start_flux[b*_polar_times_groups];
+#pragma omp simd
+    for (int i=0; i < _polar_times_groups; i++) {
+      boundary_flux[i] *= norm_factor;
+      start_flux[i] *= norm_factor;
+    }
+  }
 }
 
 
@@ -354,26 +430,18 @@ void VectorizedSolver::normalizeFluxes() {
  */
 void VectorizedSolver::computeFSRSources() {
 
-#pragma omp parallel default(none)
+#pragma omp parallel
   {
-    int tid;
     Material* material;
     FP_PRECISION* sigma_t;
     FP_PRECISION* sigma_s;
     FP_PRECISION* fiss_mat;
     FP_PRECISION scatter_source, fission_source;
 
-    int size = _num_groups * sizeof(FP_PRECISION);
-    FP_PRECISION* fission_sources =
-      (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
-    FP_PRECISION* scatter_sources =
-      (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
-
     /* For all FSRs, find the source */
 #pragma omp for schedule(guided)
     for (int r=0; r < _num_FSRs; r++) {
 
-      tid = omp_get_thread_num();
       material = _FSR_materials[r];
       sigma_t = material->getSigmaT();
       sigma_s = material->getSigmaS();
@@ -381,22 +449,15 @@ void VectorizedSolver::computeFSRSources() {
 
       /* Compute scatter + fission source for group G */
       for (int G=0; G < _num_groups; G++) {
-        for (int v=0; v < _num_vector_lengths; v++) {
 
-#pragma simd vectorlength(VEC_LENGTH)
-          for (int g=v*VEC_LENGTH; g < (v+1)*VEC_LENGTH; g++) {
-            scatter_sources[g] = sigma_s[G*_num_groups+g] * _scalar_flux(r,g);
-            fission_sources[g] = fiss_mat[G*_num_groups+g] * _scalar_flux(r,g);
-          }
-        }
+        scatter_source = 0.;
+        fission_source = 0.;
 
-#ifdef SINGLE
-        scatter_source=cblas_sasum(_num_groups, scatter_sources, 1);
-        fission_source=cblas_sasum(_num_groups, fission_sources, 1);
-#else
-        scatter_source=cblas_dasum(_num_groups, scatter_sources, 1);
-        fission_source=cblas_dasum(_num_groups, fission_sources, 1);
-#endif
+#pragma omp simd reduction(+:scatter_source,fission_source)
+        for (int g=0; g < _num_groups; g++) {
+          scatter_source += sigma_s[G*_num_groups+g] * _scalar_flux(r,g);
+          fission_source += fiss_mat[G*_num_groups+g] * _scalar_flux(r,g);
+        }
 
         fission_source /= _k_eff;
 
@@ -406,9 +467,6 @@ void VectorizedSolver::computeFSRSources() {
         _reduced_sources(r,G) *= ONE_OVER_FOUR_PI / sigma_t[G];
       }
     }
-
-    MM_FREE(fission_sources);
-    MM_FREE(scatter_sources);
   }
 }
 
@@ -434,23 +492,13 @@ void VectorizedSolver::addSourceToScalarFlux() {
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        _scalar_flux(r,e) *= 0.5;
-
-      /* Loop over energy groups within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        _scalar_flux(r,e) = _scalar_flux(r,e) / (sigma_t[e] * volume);
-
-      /* Loop over energy groups within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
+#pragma omp simd
+      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++) {
+        _scalar_flux(r,e) /= (sigma_t[e] * volume);
         _scalar_flux(r,e) += FOUR_PI * _reduced_sources(r,e);
+      }
     }
   }
-
-  return;
 }
 
 
@@ -459,21 +507,18 @@ void VectorizedSolver::addSourceToScalarFlux() {
  */
 void VectorizedSolver::computeKeff() {
 
-  FP_PRECISION fission;
-
-  int size = _num_FSRs * sizeof(FP_PRECISION);
-  FP_PRECISION* FSR_rates = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+  double fission;
 
-  size = _num_threads * _num_groups * sizeof(FP_PRECISION);
-  FP_PRECISION* group_rates = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+  int size = _num_FSRs * sizeof(double);
+  double* FSR_rates = (double*)MM_MALLOC(size, VEC_ALIGNMENT);
 
 #pragma omp parallel
   {
 
-    int tid = omp_get_thread_num() * _num_groups;
     Material* material;
     FP_PRECISION* sigma;
     FP_PRECISION volume;
+    FP_PRECISION rate;
 
     /* Compute the new nu-fission rates in each FSR */
 #pragma omp for schedule(guided)
@@ -482,105 +527,84 @@ void VectorizedSolver::computeKeff() {
       volume = _FSR_volumes[r];
       material = _FSR_materials[r];
       sigma = material->getNuSigmaF();
+      rate = 0.;
 
-      /* Loop over each energy group vector length */
-      for (int v=0; v < _num_vector_lengths; v++) {
-
-        /* Loop over energy groups within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
-        for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-          group_rates[tid+e] = sigma[e] * _scalar_flux(r,e);
-      }
+      /* Loop over energy groups */
+#pragma omp simd reduction(+:rate)
+      for (int e=0; e < _num_groups; e++)
+        rate += sigma[e] * _scalar_flux(r,e);
 
-#ifdef SINGLE
-      FSR_rates[r] = cblas_sasum(_num_groups, &group_rates[tid], 1) * volume;
-#else
-      FSR_rates[r] = cblas_dasum(_num_groups, &group_rates[tid], 1) * volume;
-#endif
+      FSR_rates[r] = rate * volume;
     }
   }
 
   /* Reduce new fission rates across FSRs */
-#ifdef SINGLE
-  fission = cblas_sasum(_num_FSRs, FSR_rates, 1);
-#else
-  fission = cblas_dasum(_num_FSRs, FSR_rates, 1);
-#endif
+  fission = pairwise_sum<double>(FSR_rates, _num_FSRs);
 
   _k_eff *= fission;
 
   MM_FREE(FSR_rates);
-  MM_FREE(group_rates);
 }
 
 
-
 /**
  * @brief Computes the contribution to the FSR scalar flux from a segment.
  * @details This method integrates the angular flux for a Track segment across
  *        energy groups and polar angles, and tallies it into the FSR scalar
- *        flux, and updates the Track's angular flux.
- * @param curr_segment a pointer to the Track segment of interest
+ *        flux, and updates the Track's angular flux. The segment's
+ *        contribution is accumulated in an aligned thread-local buffer in
+ *        place of the buffer provided by the caller.
+ * @param segment_id the index of the segment in the flattened segments
+ * @param length the length of the Track segment (cm)
+ * @param material a pointer to the Material in which the segment resides
+ * @param fsr_id the ID of the FSR in which the segment resides
  * @param azim_index a pointer to the azimuthal angle index for this segment
  * @param track_flux a pointer to the Track's angular flux
  * @param fsr_flux a pointer to the temporary FSR flux buffer
  */
-void VectorizedSolver::tallyScalarFlux(segment* curr_segment,
+void VectorizedSolver::tallyScalarFlux(long segment_id, FP_PRECISION length,
+                                       Material* material, int fsr_id,
                                        int azim_index,
                                        FP_PRECISION* track_flux,
                                        FP_PRECISION* fsr_flux) {
 
   int tid = omp_get_thread_num();
-  int fsr_id = curr_segment->_region_id;
   FP_PRECISION* delta_psi = &_delta_psi[tid*_num_groups];
   FP_PRECISION* exponentials = &_thread_exponentials[tid*_polar_times_groups];
+  FP_PRECISION* reduced_sources = &_reduced_sources(fsr_id,0);
+  FP_PRECISION weight;
+  fsr_flux = &_thread_fsr_fluxes[tid*_num_groups];
 
-  computeExponentials(curr_segment, exponentials);
+  /* Read the exponentials from the cache or compute them */
+  if (_exp_cache != NULL)
+    exponentials = getCachedExponentials(segment_id);
+  else
+    computeExponentials(length, material, exponentials);
 
   /* Set the FSR scalar flux buffer to zero */
   memset(fsr_flux, 0.0, _num_groups * sizeof(FP_PRECISION));
 
   /* Tally the flux contribution from segment to FSR's scalar flux */
   /* Loop over polar angles */
-  for (int p=0; p < _num_polar; p++) {
+  for (int p=0; p < _num_polar_2; p++) {
+
+    weight = _quadrature->getWeightInline(azim_index, p);
 
     /* Loop over each energy group vector length */
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        delta_psi[e] = track_flux(p,e) - _reduced_sources(fsr_id,e);
-
-      /* Loop over energy groups within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        delta_psi[e] *= exponentials(p,e);
-
-      /* Loop over energy groups within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        fsr_flux[e] += delta_psi[e] * _polar_weights(azim_index,p);
-
-      /* Loop over energy groups within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
+#pragma omp simd
+      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++) {
+        delta_psi[e] = (track_flux(p,e) - reduced_sources[e]) *
+                       exponentials(p,e);
+        fsr_flux[e] += delta_psi[e] * weight;
         track_flux(p,e) -= delta_psi[e];
+      }
     }
   }
 
-  /* Atomically increment the FSR scalar flux from the temporary array */
-  omp_set_lock(&_FSR_locks[fsr_id]);
-  {
-#ifdef SINGLE
-    vsAdd(_num_groups, &_scalar_flux(fsr_id,0), fsr_flux,
-          &_scalar_flux(fsr_id,0));
-#else
-    vdAdd(_num_groups, &_scalar_flux(fsr_id,0), fsr_flux,
-          &_scalar_flux(fsr_id,0));
-#endif
-  }
-  omp_unset_lock(&_FSR_locks[fsr_id]);
+  accumulateScalarFlux(fsr_id, fsr_flux);
 }
 
 
@@ -588,14 +612,15 @@ void VectorizedSolver::tallyScalarFlux(segment* curr_segment,
  * @brief Computes an array of the exponentials in the transport equation,
  *        \f$ exp(-\frac{\Sigma_t * l}{sin(\theta)}) \f$, for each energy group
  *        and polar angle for a given Track segment.
- * @param curr_segment pointer to the Track segment of interest
+ * @param length the length of the Track segment (cm)
+ * @param material a pointer to the Material in which the segment resides
  * @param exponentials the array to store the exponential values
  */
-void VectorizedSolver::computeExponentials(segment* curr_segment,
+void VectorizedSolver::computeExponentials(FP_PRECISION length,
+                                           Material* material,
                                            FP_PRECISION* exponentials) {
 
-  FP_PRECISION length = curr_segment->_length;
-  FP_PRECISION* sigma_t = curr_segment->_material->getSigmaT();
+  FP_PRECISION* sigma_t = material->getSigmaT();
 
   /* Evaluate the exponentials using the linear interpolation table */
   if (_exp_evaluator->isUsingInterpolation()) {
@@ -603,48 +628,26 @@ void VectorizedSolver::computeExponentials(segment* curr_segment,
 
     for (int e=0; e < _num_groups; e++) {
       tau = length * sigma_t[e];
-      for (int p=0; p < _num_polar; p++)
+      for (int p=0; p < _num_polar_2; p++)
         exponentials(p,e) = _exp_evaluator->computeExponential(tau, p);
     }
   }
 
-  /* Evalute the exponentials using the intrinsic exp(...) function */
+  /* Evalute the exponentials using the vectorized exponential function */
   else {
 
-    int tid = omp_get_thread_num();
-    FP_PRECISION* sin_thetas = _polar_quad->getSinThetas();
-    FP_PRECISION* taus = &_thread_taus[tid*_polar_times_groups];
+    FP_PRECISION inv_sin_theta;
 
-    /* Initialize the tau argument for the exponentials */
-    for (int p=0; p < _num_polar; p++) {
-
-      for (int v=0; v < _num_vector_lengths; v++) {
+    for (int p=0; p < _num_polar_2; p++) {
 
-#pragma simd vectorlength(VEC_LENGTH)
-        for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-          taus(p,e) = -sigma_t[e] * length;
-
-#pragma simd vectorlength(VEC_LENGTH)
-        for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-          taus(p,e) /= sin_thetas[p];
-      }
-    }
-
-    /* Evaluate the negative of the exponentials using Intel's MKL */
-#ifdef SINGLE
-    vsExp(_polar_times_groups, taus, exponentials);
-#else
-    vdExp(_polar_times_groups, taus, exponentials);
-#endif
-
-    /* Compute one minus the exponentials */
-    for (int p=0; p < _num_polar; p++) {
+      inv_sin_theta = 1. / _quadrature->getSinTheta(0, p);
 
       for (int v=0; v < _num_vector_lengths; v++) {
 
-#pragma simd vectorlength(VEC_LENGTH)
+#pragma omp simd
         for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-          exponentials(p,e) = 1.0 - exponentials(p,e);
+          exponentials(p,e) = 1. - simd_exp(-sigma_t[e] * length *
+                                            inv_sin_theta);
       }
     }
   }
@@ -665,36 +668,40 @@ void VectorizedSolver::computeExponentials(segment* curr_segment,
 void VectorizedSolver::transferBoundaryFlux(int track_id, int azim_index,
                                             bool direction,
                                             FP_PRECISION* track_flux) {
-  int start;
+  int next;
   bool transfer_flux;
   int track_out_id;
 
   /* For the "forward" direction */
   if (direction) {
-    start = _tracks[track_id]->isNextOut() * _polar_times_groups;
+    next = _tracks[track_id]->isNextOut();
     transfer_flux = _tracks[track_id]->getTransferFluxOut();
     track_out_id = _tracks[track_id]->getTrackOut()->getUid();
   }
 
   /* For the "reverse" direction */
   else {
-    start = _tracks[track_id]->isNextIn() * _polar_times_groups;
+    next = _tracks[track_id]->isNextIn();
     transfer_flux = _tracks[track_id]->getTransferFluxIn();
     track_out_id = _tracks[track_id]->getTrackIn()->getUid();
   }
 
-  FP_PRECISION* track_out_flux = &_boundary_flux(track_out_id,0,0,start);
+  /* The flux leaks out of vacuum boundaries */
+  if (!transfer_flux)
+    return;
+
+  FP_PRECISION* track_out_flux = &_start_flux(track_out_id,next,0,0);
 
   /* Loop over polar angles and energy groups */
-  for (int p=0; p < _num_polar; p++) {
+  for (int p=0; p < _num_polar_2; p++) {
 
     /* Loop over each energy group vector length */
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-#pragma simd vectorlength(VEC_LENGTH)
+#pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        track_out_flux(p,e) = track_flux(p,e) * transfer_flux;
+        track_out_flux(p,e) = track_flux(p,e);
     }
   }
 }
@@ -15,7 +15,7 @@
 #include <math.h>
 #include <omp.h>
 #include <stdlib.h>
-#include <mkl.h>
+#include <string.h>
 #endif
 
 /** Indexing scheme for the optical length (\f$ l\Sigma_t \f$) for a
@@ -30,11 +30,13 @@
 /**
  * @class VectorizedSolver VectorizedSolver.h "src/VectorizedSolver.h"
  * @brief This is a subclass of the CPUSolver class which uses memory-aligned
- *        data structures and Intel's auto-vectorization.
- * @note This class is only compiled if the Intel compiler is used when building
- *       OpenMOC. If building OpenMOC with the "--with-icpc" flag, then this
- *       class will be available in the "openmoc.intel.single" or
- *       "openmoc.intel.double" Python module.
+ *        data structures and OpenMP SIMD vectorization.
+ * @details The energy groups are padded to a multiple of VEC_LENGTH and all
+ *          flux and source arrays are aligned to VEC_ALIGNMENT bytes such
+ *          that the innermost loops over energy groups may be vectorized with
+ *          the instruction set (e.g., SSE, AVX2, AVX-512) selected when
+ *          building OpenMOC. This class is built with the GCC, Clang and
+ *          Intel compilers.
  */
 class VectorizedSolver : public CPUSolver {
 
@@ -53,11 +55,12 @@ protected:
    *  each thread in each energy group and polar angle */
   FP_PRECISION* _thread_exponentials;
 
-  void tallyScalarFlux(segment* curr_segment, int azim_index,
-                       FP_PRECISION* track_flux, FP_PRECISION* fsr_flux);
-  void transferBoundaryFlux(int track_id, int azim_index, bool direction,
-                            FP_PRECISION* track_flux);
-  void computeExponentials(segment* curr_segment, FP_PRECISION* exponentials);
+  /** An array for the FSR scalar flux contributions from a segment for
+   *  each thread in each energy group */
+  FP_PRECISION* _thread_fsr_fluxes;
+
+  void computeExponentials(FP_PRECISION length, Material* material,
+                           FP_PRECISION* exponentials);
 
 public:
   VectorizedSolver(TrackGenerator* track_generator=NULL);
@@ -65,15 +68,19 @@ public:
 
   int getNumVectorWidths();
 
-  void setGeometry(Geometry* geometry);
-
   void initializeExpEvaluator();
-  void initializeMaterials(solverMode mode=ADJOINT);
+  void initializeMaterials(solverMode mode=FORWARD);
   void initializeFluxArrays();
   void initializeSourceArrays();
   void initializeFixedSources();
   void initializeFSRs();
 
+  void tallyScalarFlux(long segment_id, FP_PRECISION length,
+                       Material* material, int fsr_id, int azim_index,
+                       FP_PRECISION* track_flux, FP_PRECISION* fsr_flux);
+  void transferBoundaryFlux(int track_id, int azim_index, bool direction,
+                            FP_PRECISION* track_flux);
+
   void normalizeFluxes();
   void computeFSRSources();
   void addSourceToScalarFlux();
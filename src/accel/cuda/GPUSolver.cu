@@ -1221,10 +1221,12 @@ void GPUSolver::initializeTracks() {
 
     /* Iterate through all Tracks and clone them as dev_tracks on the device */
     int index;
+    segment_arrays* segments = _track_generator->getSegmentArrays();
 
     for (int i=0; i < _tot_num_tracks; i++) {
 
-      clone_track(_tracks[i], &_dev_tracks[i], _material_IDs_to_indices);
+      clone_track(_tracks[i], &_dev_tracks[i], segments,
+                  _material_IDs_to_indices);
 
       /* Get indices to next tracks along "forward" and "reverse" directions */
       index = _tracks[i]->getTrackIn()->getUid();
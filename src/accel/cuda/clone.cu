@@ -79,38 +79,44 @@ void clone_material(Material* material_h, dev_material* material_d) {
  *          directly.
  * @param track_h pointer to a Track on the host
  * @param track_d pointer to a dev_track on the GPU
+ * @param segments the segments of all Tracks on the host
  * @param material_IDs_to_indices map of material IDs to indices
  *        in the _materials array.
  */
-void clone_track(Track* track_h, dev_track* track_d,
+void clone_track(Track* track_h, dev_track* track_d, segment_arrays* segments,
      		 std::map<int, int> &material_IDs_to_indices) {
 
+  long first_segment = segments->_track_offsets[track_h->getUid()];
+  int num_segments = segments->_track_offsets[track_h->getUid()+1] -
+                     first_segment;
+
   dev_segment* dev_segments;
-  dev_segment* host_segments = new dev_segment[track_h->getNumSegments()];
+  dev_segment* host_segments = new dev_segment[num_segments];
   dev_track new_track;
 
   new_track._uid = track_h->getUid();
-  new_track._num_segments = track_h->getNumSegments();
+  new_track._num_segments = num_segments;
   new_track._azim_angle_index = track_h->getAzimAngleIndex();
   new_track._next_in = track_h->isNextIn();
   new_track._next_out = track_h->isNextOut();
   new_track._transfer_flux_in = track_h->getTransferFluxIn();
   new_track._transfer_flux_out = track_h->getTransferFluxOut();
 
-  cudaMalloc((void**)&dev_segments,
-             track_h->getNumSegments() * sizeof(dev_segment));
+  cudaMalloc((void**)&dev_segments, num_segments * sizeof(dev_segment));
   new_track._segments = dev_segments;
 
-  for (int s=0; s < track_h->getNumSegments(); s++) {
-    segment* curr = track_h->getSegment(s);
-    host_segments[s]._length = curr->_length;
-    host_segments[s]._region_uid = curr->_region_id;
+  for (int s=0; s < num_segments; s++) {
+    long index = first_segment + s;
+    Material* material =
+      segments->_materials[segments->_material_indices[index]];
+    host_segments[s]._length = segments->_lengths[index];
+    host_segments[s]._region_uid = segments->_region_ids[index];
     host_segments[s]._material_index =
-      material_IDs_to_indices[curr->_material->getId()];
+      material_IDs_to_indices[material->getId()];
   }
 
   cudaMemcpy((void*)dev_segments, (void*)host_segments,
-             track_h->getNumSegments() * sizeof(dev_segment),
+             num_segments * sizeof(dev_segment),
              cudaMemcpyHostToDevice);
   cudaMemcpy((void*)track_d, (void*)&new_track, sizeof(dev_track),
              cudaMemcpyHostToDevice);
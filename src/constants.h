@@ -38,6 +38,17 @@
 /** Error threshold to determine if a point is to be considered on a Surface */
 #define ON_SURFACE_THRESH 1E-12
 
+/** Padding (cm) of Cell bounding boxes which ensures that Points within
+ *  ON_SURFACE_THRESH of a Cell's Surfaces are never culled by the box */
+#define CELL_BOUNDS_PADDING 1E-6
+
+/** The number of Cells in a Universe above which a uniform grid is used to
+ *  narrow down the Cells which may contain a Point */
+#define CELL_GRID_MIN_CELLS 8
+
+/** The maximum number of bins along each axis of a Universe's Cell grid */
+#define CELL_GRID_MAX_BINS 64
+
 /** Tolerance for difference of the sum of polar weights with respect to 1.0 */
 #define POLAR_WEIGHT_SUM_TOL 1E-5
 
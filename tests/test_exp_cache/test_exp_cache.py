@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+
+import os
+import sys
+from collections import OrderedDict
+sys.path.insert(0, os.pardir)
+sys.path.insert(0, os.path.join(os.pardir, 'openmoc'))
+from testing_harness import TestHarness
+from input_set import PinCellInput
+import openmoc
+import openmoc.process
+
+import numpy as np
+
+
+class ExpCacheTestHarness(TestHarness):
+    """Eigenvalue calculations for a pin cell with the exponentials read
+    from the per-segment exponential cache in each precision. The cached
+    exponentials must reproduce the fluxes computed without the cache to
+    within the precision they are stored in, and the cache must not be
+    built when it exceeds its memory budget."""
+
+    def __init__(self):
+        super(ExpCacheTestHarness, self).__init__()
+        self.input_set = PinCellInput()
+        self.precisions = OrderedDict()
+        self.results = []
+
+    def _run_openmoc(self):
+        """Run an eigenvalue calculation without and with the cache."""
+
+        # The relative tolerance on the fluxes for each cache precision
+        self.precisions['FULL'] = (openmoc.EXP_CACHE_FULL, 0.)
+        self.precisions['SINGLE'] = (openmoc.EXP_CACHE_SINGLE, 1E-6)
+        self.precisions['FIXED16'] = (openmoc.EXP_CACHE_FIXED16, 1E-4)
+
+        super(ExpCacheTestHarness, self)._run_openmoc()
+        ref_fluxes = openmoc.process.get_scalar_fluxes(self.solver)
+        self._append_result('NONE', ref_fluxes, 0.)
+
+        for name, (precision, rtol) in self.precisions.items():
+            self.solver.useExponentialCache(precision)
+            super(ExpCacheTestHarness, self)._run_openmoc()
+            self._append_result(name, ref_fluxes, rtol)
+
+        # The full precision cache fits in a budget of exactly its size
+        cache_size = self.results[1][2]
+        self.solver.useExponentialCache(openmoc.EXP_CACHE_FULL)
+        self.solver.setExponentialCacheBudget(cache_size)
+        super(ExpCacheTestHarness, self)._run_openmoc()
+        self._append_result('BUDGET', ref_fluxes, 0.)
+
+        # The cache is not built if it exceeds the budget by one byte
+        self.solver.setExponentialCacheBudget(cache_size - 1)
+        super(ExpCacheTestHarness, self)._run_openmoc()
+        self._append_result('OVER BUDGET', ref_fluxes, 0.)
+
+    def _append_result(self, name, ref_fluxes, rtol):
+        """Record the eigenvalue and whether the fluxes agree with those
+        computed without the cache."""
+
+        fluxes = openmoc.process.get_scalar_fluxes(self.solver)
+        agree = np.allclose(fluxes, ref_fluxes, rtol=rtol, atol=0.)
+        self.results.append((name, self.solver.isUsingExponentialCache(),
+                             self.solver.getExponentialCacheSize(),
+                             self.solver.getNumIterations(),
+                             self.solver.getKeff(), agree))
+
+    def _get_results(self, num_iters=True, keff=True, fluxes=True,
+                     num_fsrs=False, num_tracks=False, num_segments=False,
+                     hash_output=False):
+        """Return the eigenvalue with each cache precision and whether its
+        fluxes agree with those computed without the cache."""
+
+        outstr = ''
+        for name, cached, size, num_iters, keff, agree in self.results:
+            outstr += '{0}\tcached: {1}\tbuilt: {2}\t'.format(
+                name, cached, size > 0)
+            outstr += 'Iters: {0}\tkeff: {1:12.5E}\t'.format(num_iters, keff)
+            outstr += 'fluxes agree: {0}\n'.format(agree)
+
+        return outstr
+
+
+if __name__ == '__main__':
+    harness = ExpCacheTestHarness()
+    harness.main()
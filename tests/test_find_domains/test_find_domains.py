@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+
+import os
+import sys
+sys.path.insert(0, os.pardir)
+sys.path.insert(0, os.path.join(os.pardir, 'openmoc'))
+from testing_harness import TestHarness
+from input_set import SimpleLatticeInput
+import openmoc
+
+import numpy as np
+
+
+class FindDomainsTestHarness(TestHarness):
+    """Find the FSR, Cell and Material IDs at a grid of points in a 4x4
+    lattice with four threads. The grid includes points on the Lattice and
+    Geometry boundaries and outside the Geometry. The IDs must match those
+    found for each point on its own with getFSRId(), whatever the order of
+    the points."""
+
+    def __init__(self):
+        super(FindDomainsTestHarness, self).__init__()
+        self.input_set = SimpleLatticeInput()
+        self.num_threads = 4
+        self.results = []
+
+    def _find_domains(self, x, y):
+        """Find the FSR, Cell and Material IDs at a point from the root."""
+
+        geometry = self.input_set.geometry
+        coords = openmoc.LocalCoords(x, y, 0.)
+        coords.setUniverse(geometry.getRootUniverse())
+        cell = geometry.findCellContainingCoords(coords)
+
+        if cell is None:
+            return [-1, -1, -1]
+        else:
+            return [geometry.getFSRId(coords), cell.getId(),
+                    cell.getFillMaterial().getId()]
+
+    def _run_openmoc(self):
+        """Find the domains at the points at once and one at a time."""
+
+        geometry = self.input_set.geometry
+
+        # A 51x51 grid with a spacing of 0.1 cm, ordered row by row
+        x, y = np.meshgrid(np.linspace(-2.5, 2.5, 51),
+                           np.linspace(-2.5, 2.5, 51))
+        points = np.column_stack((x.ravel(), y.ravel()))
+        num_points = len(points)
+
+        domains = geometry.findDomainsAtPoints(points, 3 * num_points)
+        domains = np.reshape(domains, (num_points, 3))
+
+        ref_domains = np.array([self._find_domains(point[0], point[1])
+                                for point in points])
+
+        # The same points in a random order
+        order = np.random.RandomState(1).permutation(num_points)
+        shuffled_domains = geometry.findDomainsAtPoints(points[order],
+                                                        3 * num_points)
+        shuffled_domains = np.reshape(shuffled_domains, (num_points, 3))
+
+        # The characteristic point of each FSR
+        num_fsrs = geometry.getNumFSRs()
+        fsr_points = np.zeros((num_fsrs, 2))
+        for fsr in range(num_fsrs):
+            point = geometry.getFSRPoint(fsr)
+            fsr_points[fsr, :] = [point.getX(), point.getY()]
+        fsr_domains = geometry.findDomainsAtPoints(fsr_points, 3 * num_fsrs)
+        fsr_domains = np.reshape(fsr_domains, (num_fsrs, 3))
+
+        self.results.append(('# points', num_points))
+        self.results.append(('# outside',
+                             np.count_nonzero(domains[:, 0] < 0)))
+        self.results.append(('FSR IDs agree',
+                             np.array_equal(domains[:, 0], ref_domains[:, 0])))
+        self.results.append(('Cell IDs agree',
+                             np.array_equal(domains[:, 1], ref_domains[:, 1])))
+        self.results.append(('Material IDs agree',
+                             np.array_equal(domains[:, 2], ref_domains[:, 2])))
+        self.results.append(('shuffled IDs agree',
+                             np.array_equal(shuffled_domains, domains[order])))
+        self.results.append(('FSR points agree',
+                             np.array_equal(fsr_domains[:, 0],
+                                            np.arange(num_fsrs))))
+
+    def _get_results(self, num_iters=False, keff=False, fluxes=False,
+                     num_fsrs=False, num_tracks=False, num_segments=False,
+                     hash_output=False):
+        """Return whether the IDs found at once and for each point agree."""
+
+        outstr = ''
+        for name, result in self.results:
+            outstr += '{0}: {1}\n'.format(name, result)
+
+        return outstr
+
+
+if __name__ == '__main__':
+    harness = FindDomainsTestHarness()
+    harness.main()
@@ -0,0 +1,66 @@
+#!/usr/bin/env python
+
+import os
+import sys
+from collections import OrderedDict
+sys.path.insert(0, os.pardir)
+sys.path.insert(0, os.path.join(os.pardir, 'openmoc'))
+from testing_harness import TestHarness
+from input_set import SimpleLatticeInput
+import openmoc
+import openmoc.process
+
+import numpy as np
+
+
+class FluxAccumulationTestHarness(TestHarness):
+    """Eigenvalue calculations for a 4x4 lattice with each FSR scalar flux
+    accumulation algorithm. Four threads tally into the same FSRs, and the
+    lock-free algorithms must reproduce the fluxes tallied with locks to
+    within round-off from the order in which the threads add them."""
+
+    def __init__(self):
+        super(FluxAccumulationTestHarness, self).__init__()
+        self.input_set = SimpleLatticeInput()
+        self.num_threads = 4
+        self.accumulations = OrderedDict()
+        self.results = []
+
+    def _run_openmoc(self):
+        """Run an eigenvalue calculation with each accumulation algorithm."""
+
+        self.accumulations['FSR_LOCKS'] = openmoc.FSR_LOCKS
+        self.accumulations['THREAD_PRIVATE'] = openmoc.THREAD_PRIVATE
+        self.accumulations['ATOMIC_UPDATES'] = openmoc.ATOMIC_UPDATES
+
+        for name, accumulation in self.accumulations.items():
+            self.solver.setFluxAccumulation(accumulation)
+            super(FluxAccumulationTestHarness, self)._run_openmoc()
+
+            fluxes = openmoc.process.get_scalar_fluxes(self.solver)
+            self.results.append((name,
+                                 self.solver.getFluxAccumulation(),
+                                 self.solver.getNumIterations(),
+                                 self.solver.getKeff(), fluxes))
+
+    def _get_results(self, num_iters=True, keff=True, fluxes=True,
+                     num_fsrs=False, num_tracks=False, num_segments=False,
+                     hash_output=False):
+        """Return the eigenvalue from each algorithm and whether its fluxes
+        agree with those tallied with locks."""
+
+        ref_fluxes = self.results[0][4]
+
+        outstr = ''
+        for name, accumulation, num_iters, keff, fluxes in self.results:
+            agree = np.allclose(fluxes, ref_fluxes, rtol=1E-10, atol=0.)
+            outstr += '{0}\tset: {1}\tIters: {2}\tkeff: {3:12.5E}\t'.format(
+                name, accumulation == self.accumulations[name], num_iters, keff)
+            outstr += 'fluxes agree: {0}\n'.format(agree)
+
+        return outstr
+
+
+if __name__ == '__main__':
+    harness = FluxAccumulationTestHarness()
+    harness.main()
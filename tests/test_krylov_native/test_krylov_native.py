@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+
+import os
+import sys
+from collections import OrderedDict
+sys.path.insert(0, os.pardir)
+sys.path.insert(0, os.path.join(os.pardir, 'openmoc'))
+from testing_harness import TestHarness
+from input_set import PinCellInput
+import openmoc
+import openmoc.krylov
+import openmoc.process
+
+import numpy as np
+
+
+class VacuumPinCellInput(PinCellInput):
+    """A pin cell with vacuum boundaries, as required by the IRAMSolver."""
+
+    def create_geometry(self):
+        """Instantiate a pin cell Geometry with vacuum boundaries."""
+
+        zcylinder = openmoc.ZCylinder(x=0.0, y=0.0, radius=1.0, name='pin')
+
+        boundary = openmoc.RectangularPrism(4., 4.)
+        boundary.setBoundaryType(openmoc.VACUUM)
+
+        fuel = openmoc.Cell(name='fuel')
+        fuel.setFill(self.materials['UO2'])
+        fuel.addSurface(halfspace=-1, surface=zcylinder)
+
+        moderator = openmoc.Cell(name='moderator')
+        moderator.setFill(self.materials['Water'])
+        moderator.setRegion(boundary)
+        moderator.addSurface(halfspace=+1, surface=zcylinder)
+
+        root_universe = openmoc.Universe(name='root universe')
+        root_universe.addCell(fuel)
+        root_universe.addCell(moderator)
+
+        self.geometry = openmoc.Geometry()
+        self.geometry.setRootUniverse(root_universe)
+
+
+class KrylovNativeTestHarness(TestHarness):
+    """Fundamental eigenmode of a vacuum pin cell computed by power iteration
+    and by the native Krylov solver, with a CPUSolver and with a
+    VectorizedSolver whose flux arrays are padded to the vector width."""
+
+    def __init__(self):
+        super(KrylovNativeTestHarness, self).__init__()
+        self.input_set = VacuumPinCellInput()
+        self.tolerance = 1E-7
+        self.solvers = OrderedDict()
+        self.results = []
+
+    def _create_solver(self):
+        """Instantiate each type of solver."""
+
+        self.solvers['CPUSolver'] = openmoc.CPUSolver(self.track_generator)
+        self.solvers['VectorizedSolver'] = \
+            openmoc.VectorizedSolver(self.track_generator)
+
+        for solver in self.solvers.values():
+            solver.setNumThreads(self.num_threads)
+            solver.setConvergenceThreshold(self.tolerance)
+
+    def _run_openmoc(self):
+        """Compute the fundamental eigenmode with each solver by power
+        iteration and then with the native IRAMSolver."""
+
+        for name, solver in self.solvers.items():
+            self.solver = solver
+            super(KrylovNativeTestHarness, self)._run_openmoc()
+            keff = solver.getKeff()
+            fluxes = openmoc.process.get_scalar_fluxes(solver).flatten()
+
+            iram_solver = openmoc.krylov.IRAMSolver(solver)
+            iram_solver.computeEigenmodes(num_modes=1)
+            eigenvalue = iram_solver._eigenvalues[0].real
+            eigenvector = iram_solver._eigenvectors[:, 0]
+
+            self.results.append(
+                (name, keff, fluxes, eigenvalue, eigenvector))
+
+    def _get_results(self, num_iters=False, keff=True, fluxes=False,
+                     num_fsrs=False, num_tracks=False, num_segments=False,
+                     hash_output=False):
+        """Return the power iteration eigenvalue of each solver and whether
+        the Krylov eigenmode agrees with it."""
+
+        outstr = ''
+        for name, keff, fluxes, eigenvalue, eigenvector in self.results:
+            outstr += '{0}\tkeff: {1:12.5E}\t'.format(name, keff)
+            outstr += 'size: {0}\t'.format(eigenvector.size == fluxes.size)
+            outstr += 'eigenvalues agree: {0}\t'.format(
+                np.isclose(eigenvalue, keff, rtol=2E-5, atol=0.))
+            agree = np.allclose(eigenvector / np.sum(eigenvector),
+                                fluxes / np.sum(fluxes), rtol=1E-3, atol=0.)
+            outstr += 'eigenvectors agree: {0}\n'.format(agree)
+
+        return outstr
+
+
+if __name__ == '__main__':
+    harness = KrylovNativeTestHarness()
+    harness.main()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python
+
+import os
+import sys
+from collections import OrderedDict
+sys.path.insert(0, os.pardir)
+sys.path.insert(0, os.path.join(os.pardir, 'openmoc'))
+from testing_harness import TestHarness
+from input_set import SimpleLatticeInput
+import openmoc
+import openmoc.process
+
+import numpy as np
+
+
+class MixedPrecisionTestHarness(TestHarness):
+    """Eigenvalue calculations for a 4x4 lattice with the FSR scalar fluxes
+    tallied in double precision with each flux accumulation algorithm. Four
+    threads tally into the same FSRs in an arbitrary order, which only
+    changes the double precision tallies by round-off. Rounding the tallies
+    once per transport sweep must therefore yield the same fluxes for each
+    algorithm, while they differ by round-off in single precision without
+    mixed precision."""
+
+    def __init__(self):
+        super(MixedPrecisionTestHarness, self).__init__()
+        self.input_set = SimpleLatticeInput()
+        self.num_threads = 4
+        self.accumulations = OrderedDict()
+        self.results = []
+
+    def _run_openmoc(self):
+        """Run an eigenvalue calculation with each accumulation algorithm
+        without and with mixed precision."""
+
+        self.accumulations['FSR_LOCKS'] = openmoc.FSR_LOCKS
+        self.accumulations['THREAD_PRIVATE'] = openmoc.THREAD_PRIVATE
+        self.accumulations['ATOMIC_UPDATES'] = openmoc.ATOMIC_UPDATES
+
+        # Tally the fluxes with locks in FP_PRECISION for reference
+        self.solver.setFluxAccumulation(openmoc.FSR_LOCKS)
+        super(MixedPrecisionTestHarness, self)._run_openmoc()
+        self.ref_fluxes = openmoc.process.get_scalar_fluxes(self.solver)
+
+        self.solver.useMixedPrecision()
+
+        for name, accumulation in self.accumulations.items():
+            self.solver.setFluxAccumulation(accumulation)
+            super(MixedPrecisionTestHarness, self)._run_openmoc()
+
+            fluxes = openmoc.process.get_scalar_fluxes(self.solver)
+            self.results.append((name, self.solver.getNumIterations(),
+                                 self.solver.getKeff(), fluxes))
+
+    def _get_results(self, num_iters=True, keff=True, fluxes=True,
+                     num_fsrs=False, num_tracks=False, num_segments=False,
+                     hash_output=False):
+        """Return the eigenvalue from each algorithm and whether its fluxes
+        agree with those tallied without mixed precision and with those
+        tallied with locks in mixed precision."""
+
+        mixed_fluxes = self.results[0][3]
+
+        outstr = ''
+        for name, num_iters, keff, fluxes in self.results:
+            agree = np.allclose(fluxes, self.ref_fluxes, rtol=1E-5, atol=0.)
+            agree_mixed = np.allclose(fluxes, mixed_fluxes, rtol=1E-7, atol=0.)
+            outstr += '{0}\tIters: {1}\tkeff: {2:12.5E}\t'.format(
+                name, num_iters, keff)
+            outstr += 'fluxes agree: {0}\t'.format(agree)
+            outstr += 'mixed precision fluxes agree: {0}\n'.format(agree_mixed)
+
+        return outstr
+
+
+if __name__ == '__main__':
+    harness = MixedPrecisionTestHarness()
+    harness.main()
@@ -0,0 +1,94 @@
+#!/usr/bin/env python
+
+import os
+import sys
+sys.path.insert(0, os.pardir)
+sys.path.insert(0, os.path.join(os.pardir, 'openmoc'))
+from testing_harness import TestHarness
+from input_set import PinCellInput
+import openmoc
+import openmoc.process
+
+import numpy as np
+
+
+class SolverViewsTestHarness(TestHarness):
+    """Eigenvalue calculation for a pin cell followed by checks of the NumPy
+    views of the Solver's fluxes and FSR volumes. The views must alias the
+    Solver's arrays, be read-only unless requested otherwise, and only be
+    returned by get_scalar_fluxes when a copy is not requested."""
+
+    def __init__(self):
+        super(SolverViewsTestHarness, self).__init__()
+        self.input_set = PinCellInput()
+        self.results = []
+
+    def _run_openmoc(self):
+        """Run an eigenvalue calculation and inspect the views."""
+
+        super(SolverViewsTestHarness, self)._run_openmoc()
+
+        num_fsrs = self.input_set.geometry.getNumFSRs()
+        num_groups = self.input_set.geometry.getNumEnergyGroups()
+
+        fluxes = self.solver.getFluxes(num_fsrs * num_groups)
+        fluxes = np.reshape(fluxes, (num_fsrs, num_groups))
+        view = self.solver.getFluxesView()
+
+        self.results.append(('flux view shape',
+                             view.shape == (num_fsrs, num_groups)))
+        self.results.append(('flux view agrees', np.array_equal(view, fluxes)))
+        self.results.append(('flux view read-only', not view.flags.writeable))
+
+        try:
+            view[0, 0] = 0.
+            raised = False
+        except ValueError:
+            raised = True
+        self.results.append(('flux view write raises', raised))
+
+        # A change to the fluxes through a writable view is seen by the
+        # Solver and by the read-only view
+        writable_view = self.solver.getFluxesView(writable=True)
+        writable_view[0, 0] *= 2.
+        aliased = view[0, 0] == 2. * fluxes[0, 0] and \
+            self.solver.getFlux(0, 1) == 2. * fluxes[0, 0]
+        writable_view[0, 0] = fluxes[0, 0]
+        self.results.append(('flux view aliases fluxes', aliased))
+
+        volumes = self.solver.getFSRVolumesView()
+        self.results.append(('volume view agrees', np.array_equal(
+            volumes, [self.solver.getFSRVolume(fsr)
+                      for fsr in range(num_fsrs)])))
+        self.results.append(('volume view read-only',
+                             not volumes.flags.writeable))
+
+        # get_scalar_fluxes returns a copy unless asked for the view
+        copied = openmoc.process.get_scalar_fluxes(self.solver)
+        shared = openmoc.process.get_scalar_fluxes(self.solver, copy=False)
+        self.results.append(('copy agrees', np.array_equal(copied, fluxes)))
+        self.results.append(('copy is independent',
+                             not np.may_share_memory(copied, view) and
+                             copied.flags.writeable))
+        self.results.append(('no copy agrees', np.array_equal(shared, fluxes)))
+        self.results.append(('no copy shares memory',
+                             np.may_share_memory(shared, view) and
+                             not shared.flags.writeable))
+
+    def _get_results(self, num_iters=True, keff=True, fluxes=False,
+                     num_fsrs=False, num_tracks=False, num_segments=False,
+                     hash_output=False):
+        """Return the eigenvalue and the result of each check of the views."""
+
+        outstr = super(SolverViewsTestHarness, self)._get_results(
+            num_iters=num_iters, keff=keff, fluxes=fluxes)
+
+        for name, result in self.results:
+            outstr += '{0}: {1}\n'.format(name, result)
+
+        return outstr
+
+
+if __name__ == '__main__':
+    harness = SolverViewsTestHarness()
+    harness.main()
@@ -0,0 +1,77 @@
+#!/usr/bin/env python
+
+import os
+import sys
+sys.path.insert(0, os.pardir)
+sys.path.insert(0, os.path.join(os.pardir, 'openmoc'))
+from testing_harness import TestHarness
+from input_set import SimpleLatticeInput
+import openmoc
+import openmoc.process
+
+import numpy as np
+
+
+class SparseScatteringTestHarness(TestHarness):
+    """Eigenvalue calculations for a 4x4 lattice with the scattering sources
+    summed over all groups and over each group's scattering band only. The
+    band sums skip zero cross sections, which only changes the fluxes by
+    round-off, for forward and adjoint calculations and for the total source
+    residual."""
+
+    def __init__(self):
+        super(SparseScatteringTestHarness, self).__init__()
+        self.input_set = SimpleLatticeInput()
+        self.results = []
+
+    def _run_openmoc(self):
+        """Run each calculation with dense and with sparse scattering."""
+
+        calculations = [('FORWARD', openmoc.FORWARD, openmoc.FISSION_SOURCE),
+                        ('FORWARD', openmoc.FORWARD, openmoc.TOTAL_SOURCE),
+                        ('ADJOINT', openmoc.ADJOINT, openmoc.FISSION_SOURCE)]
+        res_types = {openmoc.FISSION_SOURCE: 'FISSION_SOURCE',
+                     openmoc.TOTAL_SOURCE: 'TOTAL_SOURCE'}
+
+        for mode_name, mode, res_type in calculations:
+            self.calculation_mode = mode
+            self.res_type = res_type
+            name = '{0} {1}'.format(mode_name, res_types[res_type])
+
+            self.solver.setSparseScattering(False)
+            super(SparseScatteringTestHarness, self)._run_openmoc()
+            dense_fluxes = openmoc.process.get_scalar_fluxes(self.solver)
+            self._append_result(name + ' dense', dense_fluxes)
+
+            self.solver.setSparseScattering(True)
+            super(SparseScatteringTestHarness, self)._run_openmoc()
+            self._append_result(name + ' sparse', dense_fluxes)
+
+    def _append_result(self, name, dense_fluxes):
+        """Record the eigenvalue and whether the fluxes agree with those
+        computed with dense scattering."""
+
+        fluxes = openmoc.process.get_scalar_fluxes(self.solver)
+        agree = np.allclose(fluxes, dense_fluxes, rtol=1E-5, atol=0.)
+        self.results.append((name, self.solver.isUsingSparseScattering(),
+                             self.solver.getNumIterations(),
+                             self.solver.getKeff(), agree))
+
+    def _get_results(self, num_iters=True, keff=True, fluxes=True,
+                     num_fsrs=False, num_tracks=False, num_segments=False,
+                     hash_output=False):
+        """Return the eigenvalue of each calculation and whether its fluxes
+        agree with those computed with dense scattering."""
+
+        outstr = ''
+        for name, sparse, num_iters, keff, agree in self.results:
+            outstr += '{0}\tsparse: {1}\t'.format(name, sparse)
+            outstr += 'Iters: {0}\tkeff: {1:12.5E}\t'.format(num_iters, keff)
+            outstr += 'fluxes agree: {0}\n'.format(agree)
+
+        return outstr
+
+
+if __name__ == '__main__':
+    harness = SparseScatteringTestHarness()
+    harness.main()
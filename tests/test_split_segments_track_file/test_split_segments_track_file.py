@@ -0,0 +1,63 @@
+#!/usr/bin/env python
+
+import os
+import sys
+import glob
+sys.path.insert(0, os.pardir)
+sys.path.insert(0, os.path.join(os.pardir, 'openmoc'))
+from testing_harness import TestHarness
+from input_set import PinCellInput
+import openmoc
+
+
+class SplitSegmentsTrackFileTestHarness(TestHarness):
+    """Test segment splitting based on max optical path length with CMFD
+    turned on for segments read from a Track file."""
+
+    def __init__(self):
+        super(SplitSegmentsTrackFileTestHarness, self).__init__()
+        self.input_set = PinCellInput()
+        self.read = False
+
+    def _setup(self):
+        """Build materials, geometry, CMFD, and read the Tracks from the
+        Track file written by ray tracing."""
+        self._create_geometry()
+        self._create_trackgenerator()
+
+        # Overlay simple CMFD mesh
+        cmfd = openmoc.Cmfd()
+        cmfd.setLatticeStructure(2, 2)
+        self.input_set.geometry.setCmfd(cmfd)
+
+        self._generate_tracks()
+
+        # Read the Track file with a new TrackGenerator, which would rename
+        # a rewritten Track file over the old one
+        filename = glob.glob(os.path.join('tracks', '*.data'))[0]
+        inode = os.stat(filename).st_ino
+        self._create_trackgenerator()
+        self._generate_tracks()
+        self.read = os.stat(filename).st_ino == inode
+
+        self._create_solver()
+
+    def _run_openmoc(self):
+        """Set a small max optical path length to ensure segments are split."""
+
+        # Set a small max optical path length so segments are split
+        self.solver.setMaxOpticalLength(0.5)
+
+        super(SplitSegmentsTrackFileTestHarness, self)._run_openmoc()
+
+    def _get_results(self):
+        """Digest info in the results and return as a string."""
+        outstr = super(SplitSegmentsTrackFileTestHarness, self).\
+            _get_results(num_segments=True, fluxes=False, keff=False)
+        outstr += 'read: {0}\n'.format(self.read)
+        return outstr
+
+
+if __name__ == '__main__':
+    harness = SplitSegmentsTrackFileTestHarness()
+    harness.main()
@@ -0,0 +1,113 @@
+#!/usr/bin/env python
+
+import os
+import sys
+import glob
+sys.path.insert(0, os.pardir)
+sys.path.insert(0, os.path.join(os.pardir, 'openmoc'))
+from testing_harness import TestHarness
+from input_set import PinCellInput
+import openmoc
+
+import numpy as np
+
+
+class TrackFileTestHarness(TestHarness):
+    """Eigenvalue calculation for a pin cell with Tracks read back from the
+    Track file written by ray tracing. The Track file is then truncated and
+    replaced by one for a different Geometry, each of which must be ray
+    traced again and rewritten."""
+
+    def __init__(self):
+        super(TrackFileTestHarness, self).__init__()
+        self.input_set = PinCellInput()
+        self.track_results = []
+
+    def _generate_tracks_from_file(self, geometry):
+        """Generate Tracks for a Geometry with a new TrackGenerator and return
+        it with whether the Track file was read rather than rewritten."""
+
+        filename = glob.glob(os.path.join('tracks', '*.data'))[0]
+        inode = os.stat(filename).st_ino
+
+        track_generator = \
+            openmoc.TrackGenerator(geometry, self.num_azim, self.spacing)
+        track_generator.setNumThreads(1)
+        track_generator.generateTracks()
+
+        # A rewritten Track file is renamed over the old one
+        read = os.stat(filename).st_ino == inode
+        return track_generator, read
+
+    def _get_segment_coords(self, track_generator):
+        """Return the coordinates and FSR IDs of each segment."""
+        num_segments = track_generator.getNumSegments()
+        vals_per_segment = openmoc.NUM_VALUES_PER_RETRIEVED_SEGMENT
+        return np.array(track_generator.retrieveSegmentCoords(
+            num_segments*vals_per_segment))
+
+    def _run_openmoc(self):
+        """Read, truncate and replace the Track file written by _setup()."""
+
+        filename = glob.glob(os.path.join('tracks', '*.data'))[0]
+        with open(filename, 'rb') as fh:
+            contents = fh.read()
+
+        coords = self._get_segment_coords(self.track_generator)
+
+        # Read the Track file and solve with the Tracks read from it
+        self.track_generator, read = \
+            self._generate_tracks_from_file(self.input_set.geometry)
+        agree = np.array_equal(
+            self._get_segment_coords(self.track_generator), coords)
+        self.track_results.append(('read', read, agree))
+
+        self._create_solver()
+        super(TrackFileTestHarness, self)._run_openmoc()
+
+        # Replace the Track file, which is still mapped by the TrackGenerator
+        # above, with a truncated copy
+        with open(filename + '.truncated', 'wb') as fh:
+            fh.write(contents[:len(contents)//2])
+        os.rename(filename + '.truncated', filename)
+
+        track_generator, read = \
+            self._generate_tracks_from_file(self.input_set.geometry)
+        agree = np.array_equal(
+            self._get_segment_coords(track_generator), coords)
+        with open(filename, 'rb') as fh:
+            agree = agree and fh.read() == contents
+        self.track_results.append(('truncated', read, agree))
+
+        # Ray trace an identical pin cell whose Materials and Cells have
+        # different IDs, for which the Track file is stale
+        input_set = PinCellInput()
+        input_set.create_materials()
+        input_set.create_geometry()
+
+        track_generator, read = \
+            self._generate_tracks_from_file(input_set.geometry)
+        agree = np.array_equal(
+            self._get_segment_coords(track_generator), coords)
+        self.track_results.append(('stale', read, agree))
+
+    def _get_results(self, num_iters=True, keff=True, fluxes=False,
+                     num_fsrs=False, num_tracks=False, num_segments=True,
+                     hash_output=False):
+        """Return the eigenvalue and whether each Track file was read and
+        yields the segments of the ray traced Tracks."""
+
+        outstr = super(TrackFileTestHarness, self)._get_results(
+            num_iters=num_iters, keff=keff, fluxes=fluxes,
+            num_segments=num_segments)
+
+        for name, read, agree in self.track_results:
+            outstr += '{0}\tread: {1}\tsegments agree: {2}\n'.format(
+                name, read, agree)
+
+        return outstr
+
+
+if __name__ == '__main__':
+    harness = TrackFileTestHarness()
+    harness.main()